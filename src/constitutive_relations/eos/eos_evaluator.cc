@@ -7,6 +7,7 @@
   Authors: Ethan Coon (ecoon@lanl.gov)
 */
 
+#include "shared_models.hh"
 #include "eos_factory.hh"
 #include "eos_evaluator.hh"
 
@@ -89,7 +90,8 @@ EOSEvaluator::EOSEvaluator(Teuchos::ParameterList& plist) :
   // Construct my EOS model
   AMANZI_ASSERT(plist_.isSublist("EOS parameters"));
   EOSFactory eos_fac;
-  eos_ = eos_fac.createEOS(plist_.sublist("EOS parameters"));
+  Teuchos::ParameterList& eos_plist = plist_.sublist("EOS parameters");
+  eos_ = Utils::SharedModels<EOS>::Get(eos_plist, [&]() { return eos_fac.createEOS(eos_plist); });
 };
 
 
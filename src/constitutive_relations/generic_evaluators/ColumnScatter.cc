@@ -0,0 +1,107 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! ColumnScatter moves cell fields between a surface mesh and its column domains.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <memory>
+
+#include "errors.hh"
+#include "ColumnScatter.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+const ColumnScatter&
+ColumnScatter::Get(const Teuchos::RCP<const AmanziMesh::Mesh>& surface,
+                   const std::string& domain_set)
+{
+  static std::map<std::pair<const AmanziMesh::Mesh*, std::string>,
+                  std::unique_ptr<ColumnScatter> > scatters;
+  auto& scatter = scatters[std::make_pair(surface.get(), domain_set)];
+  if (!scatter || !scatter->surface_.shares_resource(surface))
+    scatter.reset(new ColumnScatter(surface, domain_set));
+  return *scatter;
+}
+
+
+ColumnScatter::ColumnScatter(const Teuchos::RCP<const AmanziMesh::Mesh>& surface,
+                             const std::string& domain_set) :
+    surface_(surface.create_weak()),
+    domain_set_(domain_set)
+{
+  int ncols = surface->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  const Epetra_Map& cell_map = surface->cell_map(false);
+  domains_.reserve(ncols);
+  const std::string prefix = domain_set_ + "_";
+  for (int c=0; c!=ncols; ++c) {
+    domains_.emplace_back(prefix + std::to_string(cell_map.GID(c)));
+  }
+}
+
+
+int
+ColumnScatter::SurfaceIndex(const Key& column_domain) const
+{
+  std::size_t len = domain_set_.size();
+  if (column_domain.size() <= len+1 ||
+      column_domain.compare(0, len, domain_set_) != 0 ||
+      column_domain[len] != '_' ||
+      !std::all_of(column_domain.begin()+len+1, column_domain.end(),
+                   [](char c) { return std::isdigit(c); })) {
+    Errors::Message msg;
+    msg << "ColumnScatter: domain \"" << column_domain << "\" is not a column of domain set \""
+        << domain_set_ << "\".";
+    Exceptions::amanzi_throw(msg);
+  }
+  int gid = std::stoi(column_domain.substr(len+1));
+  return surface_->cell_map(false).LID(gid);
+}
+
+
+void
+ColumnScatter::Scatter(const Epetra_MultiVector& surface, State& S, const Key& var) const
+{
+  const auto& keys = Keys_(var);
+  for (int i=0; i!=keys.size(); ++i) {
+    auto& col = *S.GetFieldData(keys[i], S.GetField(keys[i])->owner())
+                ->ViewComponent("cell",false);
+    AMANZI_ASSERT(col.MyLength() == 1);
+    col[0][0] = surface[0][i];
+  }
+}
+
+
+void
+ColumnScatter::Gather(const State& S, const Key& var, Epetra_MultiVector& surface) const
+{
+  const auto& keys = Keys_(var);
+  for (int i=0; i!=keys.size(); ++i) {
+    const auto& col = *S.GetFieldData(keys[i])->ViewComponent("cell",false);
+    AMANZI_ASSERT(col.MyLength() == 1);
+    surface[0][i] = col[0][0];
+  }
+}
+
+
+const std::vector<Key>&
+ColumnScatter::Keys_(const Key& var) const
+{
+  auto entry = keys_.find(var);
+  if (entry == keys_.end()) {
+    entry = keys_.emplace(var, std::vector<Key>()).first;
+    entry->second.reserve(domains_.size());
+    for (const auto& domain : domains_) entry->second.emplace_back(Keys::getKey(domain, var));
+  }
+  return entry->second;
+}
+
+} // namespace
+} // namespace
@@ -0,0 +1,88 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! ColumnScatter moves cell fields between a surface mesh and its column domains.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*!
+
+Column runs have one column domain, e.g. "surface_column_GID", per cell of a
+surface mesh (typically "surface_star"), where GID is the global id of that
+cell.  Each column field holds the single value of its surface cell.
+
+A ColumnScatter is built once per (surface mesh, column domain set) pair, and
+holds the index map from column to surface cell and each column's keys, so
+that moving a field between the surface and all columns on this process is a
+loop over precomputed indices, with no string parsing or map lookups into the
+mesh.  Columns are those of the owned surface cells, so all moves are local
+and none of them communicate.
+
+Scatters hold their surface mesh weakly, and a scatter is rebuilt, rather than
+reused, if its mesh was freed and another allocated at the same address.
+
+*/
+
+#ifndef AMANZI_RELATIONS_COLUMN_SCATTER_HH_
+#define AMANZI_RELATIONS_COLUMN_SCATTER_HH_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Epetra_MultiVector.h"
+#include "Teuchos_RCP.hpp"
+
+#include "Key.hh"
+#include "Mesh.hh"
+#include "State.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+class ColumnScatter {
+
+ public:
+  // The shared scatter from surface to domain set, e.g. "surface_column".
+  static const ColumnScatter& Get(const Teuchos::RCP<const AmanziMesh::Mesh>& surface,
+          const std::string& domain_set);
+
+  // Number of columns on this process, which are ordered as the owned cells
+  // of the surface mesh.
+  int size() const { return domains_.size(); }
+  const Key& domain(int i) const { return domains_[i]; }
+
+  // The key of var on column i.
+  const Key& key(int i, const Key& var) const { return Keys_(var)[i]; }
+
+  // Owned surface cell index of a column domain, or -1 if that column's cell
+  // is not owned by this process.
+  int SurfaceIndex(const Key& column_domain) const;
+
+  // Copy surface cell values to the var field of all columns.
+  void Scatter(const Epetra_MultiVector& surface, State& S, const Key& var) const;
+
+  // Copy the var field of all columns to (owned) surface cell values.
+  void Gather(const State& S, const Key& var, Epetra_MultiVector& surface) const;
+
+ private:
+  ColumnScatter(const Teuchos::RCP<const AmanziMesh::Mesh>& surface,
+                const std::string& domain_set);
+
+  const std::vector<Key>& Keys_(const Key& var) const;
+
+ private:
+  Teuchos::RCP<const AmanziMesh::Mesh> surface_;  // weak
+  std::string domain_set_;
+  std::vector<Key> domains_;
+  mutable std::map<Key, std::vector<Key> > keys_;
+};
+
+} // namespace
+} // namespace
+
+#endif
@@ -22,6 +22,8 @@ OR
   
  */
 
+#include "errors.hh"
+#include "ColumnScatter.hh"
 #include "SubgridDisaggregateEvaluator.hh"
 
 namespace Amanzi {
@@ -29,7 +31,7 @@ namespace Relations {
 
 SubgridDisaggregateEvaluator::SubgridDisaggregateEvaluator(Teuchos::ParameterList& plist) :
     SecondaryVariableFieldEvaluator(plist),
-    source_gid_(-1)
+    source_lid_(-1)
 {
   // my_key_ = "surface_column_6-del_max"
   domain_ = Keys::getDomain(my_key_);  // "surface_column_6"
@@ -49,20 +51,22 @@ void
 SubgridDisaggregateEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
         const Teuchos::Ptr<CompositeVector>& result)
 {
-  if (source_gid_ < 0) {
+  if (source_lid_ < 0) {
     auto pos = domain_.find_last_of('_');
-    AMANZI_ASSERT(pos != domain_.size());
-    AMANZI_ASSERT(pos != domain_.size()-1);
-    int col_id = std::stoi(domain_.substr(pos+1, domain_.size()));
-    AMANZI_ASSERT(col_id >= 0 && col_id <= 1e3);
-    source_gid_ = col_id; // 6
+    AMANZI_ASSERT(pos != std::string::npos);
+    source_lid_ = ColumnScatter::Get(S->GetMesh(source_domain_), domain_.substr(0, pos))
+                  .SurfaceIndex(domain_); // "surface_column", 6 --> lid
+    if (source_lid_ < 0) {
+      Errors::Message msg;
+      msg << "SubgridDisaggregateEvaluator: surface cell of column \"" << domain_
+          << "\" is not owned by this process.";
+      Exceptions::amanzi_throw(msg);
+    }
   }
 
   const auto& source = *S->GetFieldData(source_key_)->ViewComponent("cell",false);
-
-  int source_lid = S->GetMesh("surface")->cell_map(false).LID(source_gid_);
-  AMANZI_ASSERT(source.MyLength() > source_lid);
-  (*result->ViewComponent("cell", false))[0][0] = source[0][source_lid];
+  AMANZI_ASSERT(source.MyLength() > source_lid_);
+  (*result->ViewComponent("cell", false))[0][0] = source[0][source_lid_];
 }
 
 void
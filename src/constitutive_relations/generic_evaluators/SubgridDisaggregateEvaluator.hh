@@ -19,6 +19,11 @@ ONE OF:
 OR
 * `"field key`" ``[string]`` **DOMAIN-FIELD_SUFFIX** 
 
+Column runs only create columns for owned surface cells, so the source value
+is always local.  Moving fields between the surface and all columns at once is
+done by ColumnScatter; this evaluator remains so that column fields read by
+column PKs have an evaluator in the dependency graph, and it reads its value
+through the same precomputed index.
   
  */
 
@@ -59,7 +64,7 @@ class SubgridDisaggregateEvaluator : public SecondaryVariableFieldEvaluator {
   Key source_domain_;
   Key domain_;
   Key source_key_;
-  int source_gid_;
+  int source_lid_;
 
  private:
   static Utils::RegisteredFactory<FieldEvaluator,SubgridDisaggregateEvaluator> factory_;
@@ -0,0 +1,81 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! TimeSeriesEvaluator sets a field from a time series streamed from HDF5.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include "TimeSeriesEvaluator.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+TimeSeriesEvaluator::TimeSeriesEvaluator(Teuchos::ParameterList& plist)
+    : IndependentVariableFieldEvaluator(plist)
+{
+  temporally_variable_ = true;
+}
+
+Teuchos::RCP<FieldEvaluator>
+TimeSeriesEvaluator::Clone() const {
+  return Teuchos::rcp(new TimeSeriesEvaluator(*this));
+}
+
+void
+TimeSeriesEvaluator::Configure(State& S, const Key& key,
+        const Teuchos::ParameterList& data_list, const std::string& value_header) {
+  if (S.FEList().isSublist(key)) return;
+  Teuchos::ParameterList& eval_list = S.FEList().sublist(key);
+  eval_list.setParameters(data_list);
+  eval_list.set("field evaluator type", "time series");
+  eval_list.set("value header", value_header);
+}
+
+// Required methods from IndependentVariableFieldEvaluator
+void
+TimeSeriesEvaluator::UpdateField_(const Teuchos::Ptr<State>& S) {
+  CompositeVector& result = *S->GetFieldData(my_key_, my_key_);
+  const AmanziMesh::Mesh& mesh = *result.Mesh();
+
+  if (reader_ == Teuchos::null) {
+    std::string interp = plist_.get<std::string>("interpolation", "linear");
+    if (interp != "linear" && interp != "constant") {
+      Errors::Message message;
+      message << "TimeSeriesEvaluator: for \"" << my_key_ << "\", \"interpolation\" must be \"linear\" or \"constant\", not \"" << interp << "\".";
+      Exceptions::amanzi_throw(message);
+    }
+    reader_ = Teuchos::rcp(new TimeSeriesReader(plist_.get<std::string>("file"),
+            plist_.get<std::string>("time header", "time [s]"),
+            plist_.get<std::string>("value header"),
+            plist_.get<int>("chunk size", 240),
+            interp == "constant",
+            plist_.get<bool>("prefetch", false),
+            mesh.cell_map(false)));
+  }
+
+  // collective, even if this rank has no cells
+  reader_->Values(S->time(), values_);
+
+  for (auto& comp : result) {
+    if (comp != "cell") {
+      Errors::Message message;
+      message << "TimeSeriesEvaluator: components on mesh entities named \"" << comp << "\" are not supported.";
+      Exceptions::amanzi_throw(message);
+    }
+  }
+
+  Epetra_MultiVector& res_c = *result.ViewComponent("cell",false);
+  if (!reader_->distributed()) {
+    res_c.PutScalar(values_[0]);
+  } else {
+    for (int c=0; c!=res_c.MyLength(); ++c) res_c[0][c] = values_[c];
+  }
+  computed_once_ = true;
+}
+
+} //namespace
+} //namespace
@@ -0,0 +1,86 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! TimeSeriesEvaluator sets a field from a time series streamed from HDF5.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*!
+
+An independent variable read from a time series in an HDF5 file, intended for
+long meteorological forcing datasets driving the surface energy balance.
+Unlike a `"function-tabular`" independent variable, the data is not all read
+and held by every rank, and the value is interpolated once per time rather
+than once per cell.  See TimeSeriesReader.
+
+If the values dataset is 1D, the field is set to the interpolated value
+everywhere.  If it is 2D, it must have one column per cell of the mesh, and
+each cell takes the value in the column of its global ID.
+
+* `"file`" ``[string]`` HDF5 file holding the time series.
+
+* `"time header`" ``[string]`` **time [s]** Name of the dataset of times.
+
+* `"value header`" ``[string]`` Name of the dataset of values.
+
+* `"interpolation`" ``[string]`` **linear** One of `"linear`" or `"constant`",
+  the latter holding each value until the next time.
+
+* `"chunk size`" ``[int]`` **240** Number of times read at once.
+
+* `"prefetch`" ``[bool]`` **false** Read the next chunk in the background.
+  Requires HDF5 built thread-safe, and is ignored otherwise.
+
+Evaluators consuming forcing data, e.g. the surface energy balance, may set
+these up themselves through Configure(), from one list naming the file.
+
+*/
+
+#ifndef AMANZI_RELATIONS_TIME_SERIES_EVALUATOR_HH_
+#define AMANZI_RELATIONS_TIME_SERIES_EVALUATOR_HH_
+
+#include "factory.hh"
+#include "independent_variable_field_evaluator.hh"
+
+#include "TimeSeriesReader.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+class TimeSeriesEvaluator : public IndependentVariableFieldEvaluator {
+
+ public:
+  explicit
+  TimeSeriesEvaluator(Teuchos::ParameterList& plist);
+  TimeSeriesEvaluator(const TimeSeriesEvaluator& other) = default;
+
+  virtual Teuchos::RCP<FieldEvaluator> Clone() const override;
+
+  // Make the evaluator of key, unless one is already listed in S, read the
+  // dataset value_header of the file described by data_list, which holds
+  // the parameters above other than "value header".
+  static void Configure(State& S, const Key& key,
+                        const Teuchos::ParameterList& data_list,
+                        const std::string& value_header);
+
+ protected:
+  // Required methods from IndependentVariableFieldEvaluator
+  virtual void UpdateField_(const Teuchos::Ptr<State>& S) override;
+
+ protected:
+  Teuchos::RCP<TimeSeriesReader> reader_;
+  std::vector<double> values_;
+
+ private:
+  static Utils::RegisteredFactory<FieldEvaluator,TimeSeriesEvaluator> reg_;
+
+};
+
+} //namespace
+} //namespace
+
+#endif
@@ -0,0 +1,18 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/*
+  TimeSeriesEvaluator sets a field from a time series streamed from HDF5.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include "TimeSeriesEvaluator.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+// registry of method
+Utils::RegisteredFactory<FieldEvaluator,TimeSeriesEvaluator> TimeSeriesEvaluator::reg_("time series");
+
+} // namespace
+} // namespace
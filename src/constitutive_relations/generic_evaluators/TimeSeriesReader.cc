@@ -0,0 +1,311 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! TimeSeriesReader streams a time series from an HDF5 file in chunks.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include <algorithm>
+
+#include "hdf5.h"
+#include "Epetra_MultiVector.h"
+
+#include "errors.hh"
+#include "TimeSeriesReader.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+namespace {
+
+// Read rows [begin, begin+count) of a 1D or 2D dataset.  ncols is 1 for a
+// 1D dataset.
+std::vector<double>
+ReadHDF5Rows(const std::string& filename, const std::string& name,
+             int begin, int count, int ncols)
+{
+  hid_t file = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (file < 0) {
+    Errors::Message msg;
+    msg << "TimeSeriesReader: cannot open file \"" << filename << "\"";
+    Exceptions::amanzi_throw(msg);
+  }
+  hid_t dset = H5Dopen2(file, name.c_str(), H5P_DEFAULT);
+  if (dset < 0) {
+    H5Fclose(file);
+    Errors::Message msg;
+    msg << "TimeSeriesReader: no dataset \"" << name << "\" in file \"" << filename << "\"";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  hid_t fspace = H5Dget_space(dset);
+  int ndims = H5Sget_simple_extent_ndims(fspace);
+  hsize_t start[2] = { (hsize_t) begin, 0 };
+  hsize_t counts[2] = { (hsize_t) count, (hsize_t) ncols };
+  H5Sselect_hyperslab(fspace, H5S_SELECT_SET, start, NULL, counts, NULL);
+  hid_t mspace = H5Screate_simple(ndims, counts, NULL);
+
+  std::vector<double> data(count * ncols);
+  herr_t ierr = H5Dread(dset, H5T_NATIVE_DOUBLE, mspace, fspace, H5P_DEFAULT, data.data());
+
+  H5Sclose(mspace);
+  H5Sclose(fspace);
+  H5Dclose(dset);
+  H5Fclose(file);
+
+  if (ierr < 0) {
+    Errors::Message msg;
+    msg << "TimeSeriesReader: error reading dataset \"" << name << "\" from file \"" << filename << "\"";
+    Exceptions::amanzi_throw(msg);
+  }
+  return data;
+}
+
+
+// Dimensions of a 1D or 2D dataset, as {nrows, ncols}.
+std::vector<int>
+HDF5Dimensions(const std::string& filename, const std::string& name)
+{
+  hid_t file = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (file < 0) {
+    Errors::Message msg;
+    msg << "TimeSeriesReader: cannot open file \"" << filename << "\"";
+    Exceptions::amanzi_throw(msg);
+  }
+  hid_t dset = H5Dopen2(file, name.c_str(), H5P_DEFAULT);
+  if (dset < 0) {
+    H5Fclose(file);
+    Errors::Message msg;
+    msg << "TimeSeriesReader: no dataset \"" << name << "\" in file \"" << filename << "\"";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  hid_t fspace = H5Dget_space(dset);
+  int ndims = H5Sget_simple_extent_ndims(fspace);
+  hsize_t dims[2] = { 0, 1 };
+  if (ndims == 1 || ndims == 2) H5Sget_simple_extent_dims(fspace, dims, NULL);
+  H5Sclose(fspace);
+  H5Dclose(dset);
+  H5Fclose(file);
+
+  if (ndims != 1 && ndims != 2) {
+    Errors::Message msg;
+    msg << "TimeSeriesReader: dataset \"" << name << "\" must be 1D or 2D.";
+    Exceptions::amanzi_throw(msg);
+  }
+  return std::vector<int>{ (int) dims[0], (int) dims[1] };
+}
+
+} // namespace
+
+
+TimeSeriesReader::TimeSeriesReader(const std::string& filename,
+                                   const std::string& time_header,
+                                   const std::string& value_header,
+                                   int chunk_size, bool piecewise_constant, bool prefetch,
+                                   const Epetra_Map& map) :
+    filename_(filename),
+    value_header_(value_header),
+    map_(map),
+    comm_(map_.Comm()),
+    chunk_size_(chunk_size),
+    constant_(piecewise_constant),
+    prefetch_(prefetch),
+    ncols_(1),
+    nlocal_(1),
+    interval_(0),
+    chunk_begin_(-1),
+    next_begin_(-1)
+{
+#ifndef H5_HAVE_THREADSAFE
+  prefetch_ = false;
+#endif
+  if (chunk_size_ < 1) {
+    Errors::Message msg("TimeSeriesReader: \"chunk size\" must be positive.");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  // rank 0 reads the times and the shape of the values, then broadcasts
+  int sizes[3] = { 0, 1, 1 }; // ntimes, ncols, ok
+  std::string error;
+  if (comm_.MyPID() == 0) {
+    try {
+      std::vector<int> tdims = HDF5Dimensions(filename_, time_header);
+      std::vector<int> vdims = HDF5Dimensions(filename_, value_header_);
+      if (tdims[1] != 1 || tdims[0] != vdims[0] || tdims[0] == 0) {
+        Errors::Message msg;
+        msg << "TimeSeriesReader: dataset \"" << value_header_
+            << "\" must have one row per entry of \"" << time_header << "\".";
+        Exceptions::amanzi_throw(msg);
+      }
+      times_ = ReadHDF5Rows(filename_, time_header, 0, tdims[0], 1);
+      sizes[0] = vdims[0];
+      sizes[1] = vdims[1];
+    } catch (const std::exception& e) {
+      sizes[2] = 0;
+      error = e.what();
+    }
+  }
+  comm_.Broadcast(sizes, 3, 0);
+  if (!sizes[2]) {
+    Errors::Message msg;
+    msg << "TimeSeriesReader: failed reading \"" << filename_ << "\"";
+    if (!error.empty()) msg << ": " << error;
+    Exceptions::amanzi_throw(msg);
+  }
+
+  ncols_ = sizes[1];
+  times_.resize(sizes[0]);
+  comm_.Broadcast(times_.data(), sizes[0], 0);
+
+  for (int i=1; i<times_.size(); ++i) {
+    if (times_[i] <= times_[i-1]) {
+      Errors::Message msg;
+      msg << "TimeSeriesReader: times in \"" << filename_ << "\" are not strictly increasing.";
+      Exceptions::amanzi_throw(msg);
+    }
+  }
+
+  // rows of one value per map entry are imported, not broadcast
+  if (ncols_ > 1) {
+    if (ncols_ != map_.NumGlobalElements()) {
+      Errors::Message msg;
+      msg << "TimeSeriesReader: dataset \"" << value_header_ << "\" in \"" << filename_
+          << "\" must have one column or one column per entry (" << map_.NumGlobalElements() << ").";
+      Exceptions::amanzi_throw(msg);
+    }
+    root_map_ = Teuchos::rcp(new Epetra_Map(ncols_, comm_.MyPID() == 0 ? ncols_ : 0, 0, comm_));
+    importer_ = Teuchos::rcp(new Epetra_Import(map_, *root_map_));
+    nlocal_ = map_.NumMyElements();
+  }
+}
+
+
+TimeSeriesReader::~TimeSeriesReader()
+{
+  if (next_.valid()) next_.wait();
+}
+
+
+void
+TimeSeriesReader::Values(double t, std::vector<double>& values)
+{
+  int n = times_.size();
+  int i = FindInterval_(t);
+  int row = std::min(std::max(i, 0), n-1);
+  EnsureRows_(row);
+
+  values.resize(nlocal_);
+  const double* v0 = chunk_.data() + (row - chunk_begin_) * nlocal_;
+  if (i < 0 || i == n-1 || constant_) {
+    std::copy(v0, v0 + nlocal_, values.begin());
+  } else {
+    const double* v1 = v0 + nlocal_;
+    double w = (t - times_[i]) / (times_[i+1] - times_[i]);
+    for (int j=0; j!=nlocal_; ++j) values[j] = (1-w) * v0[j] + w * v1[j];
+  }
+}
+
+
+// Time only moves forward during a step, and backs up a little on a failed
+// step, so check the last interval and the one after before searching.
+int
+TimeSeriesReader::FindInterval_(double t)
+{
+  int n = times_.size();
+  if (t < times_[0]) return -1;
+  if (t >= times_[n-1]) return n-1;
+
+  int i = interval_;
+  if (t >= times_[i] && t < times_[i+1]) return i;
+  if (i+2 < n && t >= times_[i+1] && t < times_[i+2]) {
+    interval_ = i+1;
+    return interval_;
+  }
+  interval_ = std::upper_bound(times_.begin(), times_.end(), t) - times_.begin() - 1;
+  return interval_;
+}
+
+
+void
+TimeSeriesReader::EnsureRows_(int i)
+{
+  if (chunk_begin_ >= 0 && i >= chunk_begin_ && i < chunk_begin_ + chunk_size_) return;
+
+  int n = times_.size();
+  int begin = (i / chunk_size_) * chunk_size_;
+  int count = std::min(chunk_size_ + 1, n - begin);
+
+  int ok = 1;
+  std::string error;
+  std::vector<double> rows;
+  if (comm_.MyPID() == 0) {
+    try {
+      if (next_.valid() && next_begin_ == begin) {
+        rows = next_.get();
+      } else {
+        if (next_.valid()) next_.wait(); // a jump in time, discard it
+        next_ = std::future<std::vector<double> >();
+        rows = ReadHDF5Rows(filename_, value_header_, begin, count, ncols_);
+      }
+    } catch (const std::exception& e) {
+      ok = 0;
+      error = e.what();
+    }
+  }
+  comm_.Broadcast(&ok, 1, 0);
+  if (!ok) {
+    Errors::Message msg;
+    msg << "TimeSeriesReader: failed reading \"" << filename_ << "\"";
+    if (!error.empty()) msg << ": " << error;
+    Exceptions::amanzi_throw(msg);
+  }
+
+  Distribute_(rows, count);
+  chunk_begin_ = begin;
+
+  // start reading the next chunk
+  next_begin_ = begin + chunk_size_;
+  if (prefetch_ && comm_.MyPID() == 0 && next_begin_ < n) {
+    int next_count = std::min(chunk_size_ + 1, n - next_begin_);
+    std::string filename = filename_, name = value_header_;
+    int b = next_begin_, nc = ncols_;
+    next_ = std::async(std::launch::async, [=]() {
+        return ReadHDF5Rows(filename, name, b, next_count, nc);
+      });
+  }
+}
+
+
+void
+TimeSeriesReader::Distribute_(const std::vector<double>& rows, int count)
+{
+  if (!distributed()) {
+    chunk_ = rows;
+    chunk_.resize(count);
+    comm_.Broadcast(chunk_.data(), count, 0);
+    return;
+  }
+
+  // one vector per row, all on rank 0, imported to the map
+  Epetra_MultiVector root(*root_map_, count);
+  if (comm_.MyPID() == 0) {
+    for (int j=0; j!=count; ++j) {
+      std::copy(rows.data() + j*ncols_, rows.data() + (j+1)*ncols_, root[j]);
+    }
+  }
+  Epetra_MultiVector local(map_, count);
+  local.Import(root, *importer_, Insert);
+
+  chunk_.resize(count * nlocal_);
+  for (int j=0; j!=count; ++j) {
+    std::copy(local[j], local[j] + nlocal_, chunk_.data() + j*nlocal_);
+  }
+}
+
+} // namespace
+} // namespace
@@ -0,0 +1,109 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! TimeSeriesReader streams a time series from an HDF5 file in chunks.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*!
+
+Reads a time series from an HDF5 file holding a 1D dataset of times and a
+dataset of values, which is either 1D (one value per time) or 2D (one row of
+values per time).  Only the times are read up front; values are read in
+chunks of consecutive rows, so that years of hourly data need not be held in
+memory.  Rank 0 reads each chunk.  A 1D chunk is broadcast; a 2D chunk has
+one column per entry of a map, e.g. the cells of a mesh by global ID, and
+each rank receives only the columns of its own entries.
+
+Interpolation in time keeps the index of the last bracketing interval, so
+that the typical query, a slightly later time, costs no search.  Before the
+first and after the last time the series is held constant.
+
+If `"prefetch`" is true, rank 0 reads the next chunk on a background thread
+while the current one is in use.  This requires an HDF5 built thread-safe;
+otherwise chunks are read when needed.
+
+*/
+
+#ifndef AMANZI_RELATIONS_TIME_SERIES_READER_HH_
+#define AMANZI_RELATIONS_TIME_SERIES_READER_HH_
+
+#include <future>
+#include <string>
+#include <vector>
+
+#include "Epetra_Comm.h"
+#include "Epetra_Import.h"
+#include "Epetra_Map.h"
+#include "Teuchos_RCP.hpp"
+
+namespace Amanzi {
+namespace Relations {
+
+class TimeSeriesReader {
+
+ public:
+  TimeSeriesReader(const std::string& filename,
+                   const std::string& time_header,
+                   const std::string& value_header,
+                   int chunk_size, bool piecewise_constant, bool prefetch,
+                   const Epetra_Map& map);
+  ~TimeSeriesReader();
+
+  // Number of values per time on this rank: 1 for a 1D values dataset, else
+  // the number of local entries of the map.
+  int size() const { return nlocal_; }
+
+  // Is there one value per entry of the map?
+  bool distributed() const { return importer_ != Teuchos::null; }
+
+  // Values at time t, interpolated, in the local order of the map if
+  // distributed.  Collective, as it may load a chunk.
+  void Values(double t, std::vector<double>& values);
+
+ protected:
+  // index of the interval [times_[i], times_[i+1]) containing t
+  int FindInterval_(double t);
+
+  // make rows [i, i+1] available, loading chunks as needed
+  void EnsureRows_(int i);
+
+  // move count rows read by rank 0 into this rank's chunk_
+  void Distribute_(const std::vector<double>& rows, int count);
+
+ protected:
+  std::string filename_;
+  std::string value_header_;
+  Epetra_Map map_;
+  const Epetra_Comm& comm_;
+  int chunk_size_;
+  bool constant_;
+  bool prefetch_;
+
+  std::vector<double> times_;
+  int ncols_;
+  int nlocal_;
+  int interval_;
+
+  // from all columns on rank 0 to the map, if distributed
+  Teuchos::RCP<Epetra_Map> root_map_;
+  Teuchos::RCP<Epetra_Import> importer_;
+
+  // the loaded chunk holds rows [chunk_begin_, chunk_begin_ + chunk_size_],
+  // i.e. one row more than the chunk so that every interval's end is present,
+  // with nlocal_ values per row
+  int chunk_begin_;
+  std::vector<double> chunk_;
+
+  int next_begin_;
+  std::future<std::vector<double> > next_;
+};
+
+} // namespace
+} // namespace
+
+#endif
@@ -0,0 +1,115 @@
+#include <string>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "hdf5.h"
+#include "Epetra_Map.h"
+#include "Epetra_MpiComm.h"
+
+#include "errors.hh"
+#include "TimeSeriesReader.hh"
+
+using namespace Amanzi;
+
+// Times 0, 10, ..., 90, a 1D series of i^2, and a 2D series of
+// 100 * column + i^2, so that linear interpolation is visible.
+struct series {
+  Epetra_MpiComm comm;
+  std::string filename;
+  int ntimes, ncols;
+
+  series() :
+      comm(MPI_COMM_WORLD),
+      filename("test_time_series.h5"),
+      ntimes(10),
+      ncols(7)
+  {
+    if (comm.MyPID() == 0) {
+      std::vector<double> times(ntimes), scalar(ntimes), cells(ntimes*ncols);
+      for (int i=0; i!=ntimes; ++i) {
+        times[i] = 10. * i;
+        scalar[i] = i * i;
+        for (int j=0; j!=ncols; ++j) cells[i*ncols + j] = 100. * j + i * i;
+      }
+
+      hid_t file = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+      Write(file, "time [s]", times, 1);
+      Write(file, "scalar", scalar, 1);
+      Write(file, "cells", cells, 2);
+      H5Fclose(file);
+    }
+    comm.Barrier();
+  }
+
+  void Write(hid_t file, const std::string& name, const std::vector<double>& data, int ndims) {
+    hsize_t dims[2] = { (hsize_t) ntimes, (hsize_t) ncols };
+    hid_t space = H5Screate_simple(ndims, dims, NULL);
+    hid_t dset = H5Dcreate2(file, name.c_str(), H5T_NATIVE_DOUBLE, space,
+                            H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
+    H5Dclose(dset);
+    H5Sclose(space);
+  }
+};
+
+
+TEST_FIXTURE(series, TimeSeriesReaderLinear) {
+  Epetra_Map map(ncols, 0, comm);
+  Relations::TimeSeriesReader reader(filename, "time [s]", "scalar", 3, false, false, map);
+  CHECK(!reader.distributed());
+  CHECK_EQUAL(1, reader.size());
+
+  std::vector<double> values;
+  reader.Values(-5., values);   // held before the first time
+  CHECK_CLOSE(0., values[0], 1.e-12);
+  reader.Values(15., values);
+  CHECK_CLOSE(2.5, values[0], 1.e-12);
+  reader.Values(20., values);
+  CHECK_CLOSE(4., values[0], 1.e-12);
+  reader.Values(45., values);   // the next chunk
+  CHECK_CLOSE(20.5, values[0], 1.e-12);
+  reader.Values(90., values);
+  CHECK_CLOSE(81., values[0], 1.e-12);
+  reader.Values(200., values);  // held after the last time
+  CHECK_CLOSE(81., values[0], 1.e-12);
+  reader.Values(5., values);    // back to the first chunk
+  CHECK_CLOSE(0.5, values[0], 1.e-12);
+}
+
+
+TEST_FIXTURE(series, TimeSeriesReaderConstant) {
+  Epetra_Map map(ncols, 0, comm);
+  Relations::TimeSeriesReader reader(filename, "time [s]", "scalar", 4, true, false, map);
+
+  std::vector<double> values;
+  reader.Values(15., values);
+  CHECK_CLOSE(1., values[0], 1.e-12);
+  reader.Values(59.9, values);
+  CHECK_CLOSE(25., values[0], 1.e-12);
+}
+
+
+TEST_FIXTURE(series, TimeSeriesReaderDistributed) {
+  Epetra_Map map(ncols, 0, comm);
+  Relations::TimeSeriesReader reader(filename, "time [s]", "cells", 3, false, false, map);
+  CHECK(reader.distributed());
+  CHECK_EQUAL(map.NumMyElements(), reader.size());
+
+  std::vector<double> values;
+  for (double t : { 25., 65. }) {
+    reader.Values(t, values);
+    int i = (int) (t / 10.);
+    double w = (t - 10.*i) / 10.;
+    for (int c=0; c!=map.NumMyElements(); ++c) {
+      double expected = 100. * map.GID(c) + (1-w) * i * i + w * (i+1) * (i+1);
+      CHECK_CLOSE(expected, values[c], 1.e-12);
+    }
+  }
+}
+
+
+TEST_FIXTURE(series, TimeSeriesReaderWrongColumns) {
+  Epetra_Map map(ncols-2, 0, comm);
+  CHECK_THROW(Relations::TimeSeriesReader(filename, "time [s]", "cells", 3, false, false, map),
+              Errors::Message);
+}
@@ -7,6 +7,7 @@
   Authors: Ethan Coon (ecoon@lanl.gov)
 */
 
+#include "boundary_face_plan.hh"
 #include "overland_source_from_subsurface_flux_evaluator.hh"
 
 namespace Amanzi {
@@ -47,7 +48,6 @@ OverlandSourceFromSubsurfaceFluxEvaluator::OverlandSourceFromSubsurfaceFluxEvalu
     dens_key_(other.dens_key_),
     surface_mesh_key_(other.surface_mesh_key_),
     subsurface_mesh_key_(other.subsurface_mesh_key_),
-    face_and_dirs_(other.face_and_dirs_),
     volume_basis_(other.volume_basis_) {}
 
 Teuchos::RCP<FieldEvaluator> OverlandSourceFromSubsurfaceFluxEvaluator::Clone() const {
@@ -62,71 +62,27 @@ void OverlandSourceFromSubsurfaceFluxEvaluator::EnsureCompatibility(const Teucho
 }
 
 
-void OverlandSourceFromSubsurfaceFluxEvaluator::IdentifyFaceAndDirection_(
-        const Teuchos::Ptr<State>& S) {
-  // grab the meshes
-  Teuchos::RCP<const AmanziMesh::Mesh> subsurface = S->GetMesh(subsurface_mesh_key_);
-  Teuchos::RCP<const AmanziMesh::Mesh> surface = S->GetMesh(surface_mesh_key_);
-
-  // allocate space for face IDs and directions
-  int ncells = surface->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  face_and_dirs_ = Teuchos::rcp(new std::vector<FaceDir>(ncells));
-
-  for (int c=0; c!=ncells; ++c) {
-    // Get the face on the subsurface mesh corresponding to the cell
-    // of the surface mesh.
-    AmanziMesh::Entity_ID domain_face =
-      surface->entity_get_parent(AmanziMesh::CELL, c);
-
-    // Get the direction corresponding to that face wrt its only cell.
-    // -- get the cell
-    AmanziMesh::Entity_ID_List cells;
-    subsurface->face_get_cells(domain_face, AmanziMesh::Parallel_type::OWNED, &cells);
-    AMANZI_ASSERT(cells.size() == 1);
-
-    // -- Get directions
-    AmanziMesh::Entity_ID_List faces;
-    std::vector<int> fdirs;
-    subsurface->cell_get_faces_and_dirs(cells[0], &faces, &fdirs);
-    int index = std::find(faces.begin(), faces.end(), domain_face) - faces.begin();
-
-    // Put (face,dir) into cached data.
-    (*face_and_dirs_)[c] = std::make_pair(domain_face, fdirs[index]);
-  }
-}
-
 // Required methods from SecondaryVariableFieldEvaluator
 void OverlandSourceFromSubsurfaceFluxEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
         const Teuchos::Ptr<CompositeVector>& result) {
+  // the face on the subsurface mesh corresponding to each surface cell, its
+  // direction wrt its only cell, and that cell
+  const BoundaryFacePlan::SurfaceMap& surf_map =
+      BoundaryFacePlan::Get(S->GetMesh(subsurface_mesh_key_)).Surface(S->GetMesh(surface_mesh_key_));
 
-  if (face_and_dirs_ == Teuchos::null) {
-    IdentifyFaceAndDirection_(S);
-  }
-
-  Teuchos::RCP<const AmanziMesh::Mesh> subsurface = S->GetMesh(subsurface_mesh_key_);
   const Epetra_MultiVector& flux = *S->GetFieldData(flux_key_)->ViewComponent("face",false);
-  const Epetra_MultiVector& res_v = *result->ViewComponent("cell",false);
+  Epetra_MultiVector& res_v = *result->ViewComponent("cell",false);
 
+  int ncells = result->size("cell",false);
   if (volume_basis_) {
     const Epetra_MultiVector& dens = *S->GetFieldData(dens_key_)->ViewComponent("cell",false);
-
-    int ncells = result->size("cell",false);
     for (int c=0; c!=ncells; ++c) {
-      AmanziMesh::Entity_ID_List cells;
-      subsurface->face_get_cells((*face_and_dirs_)[c].first, AmanziMesh::Parallel_type::OWNED, &cells);
-      AMANZI_ASSERT(cells.size() == 1);
-
-      res_v[0][c] = flux[0][(*face_and_dirs_)[c].first] * (*face_and_dirs_)[c].second
-          / dens[0][cells[0]];
+      res_v[0][c] = flux[0][surf_map.faces[c]] * surf_map.dirs[c]
+          / dens[0][surf_map.cells[c]];
     }
   } else {
-    int ncells = result->size("cell",false);
     for (int c=0; c!=ncells; ++c) {
-      AmanziMesh::Entity_ID_List cells;
-      subsurface->face_get_cells((*face_and_dirs_)[c].first, AmanziMesh::Parallel_type::OWNED, &cells);
-      AMANZI_ASSERT(cells.size() == 1);
-
-      res_v[0][c] = flux[0][(*face_and_dirs_)[c].first] * (*face_and_dirs_)[c].second;
+      res_v[0][c] = flux[0][surf_map.faces[c]] * surf_map.dirs[c];
     }
   }
 }
@@ -37,11 +37,6 @@ protected:
   virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
           Key wrt_key, const Teuchos::Ptr<CompositeVector>& result);
 
-  void IdentifyFaceAndDirection_(const Teuchos::Ptr<State>& S);
-
-  typedef std::pair<int, double> FaceDir;
-  Teuchos::RCP<std::vector<FaceDir> > face_and_dirs_;
-
   Key flux_key_;
   Key dens_key_;
   bool volume_basis_;
@@ -10,6 +10,7 @@
 #include "boost/algorithm/string/predicate.hpp"
 
 
+#include "boundary_face_plan.hh"
 #include "surface_top_cells_evaluator.hh"
 
 namespace Amanzi {
@@ -49,18 +50,11 @@ SurfaceTopCellsEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   Epetra_MultiVector& result_cells = *result->ViewComponent("cell",false);
 
 
-  int ncells_surf = result->Mesh()->num_entities(AmanziMesh::CELL,
-          AmanziMesh::Parallel_type::OWNED);
-  for (unsigned int c=0; c!=ncells_surf; ++c) {
-    // get the face on the subsurface mesh
-    AmanziMesh::Entity_ID f = result->Mesh()->entity_get_parent(AmanziMesh::CELL, c);
-
-    // get the cell interior to the face
-    AmanziMesh::Entity_ID_List cells;
-    sub_vector->Mesh()->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-    AMANZI_ASSERT(cells.size() == 1);
-
-    result_cells[0][c] = sub_vector_cells[0][cells[0]];
+  // the cell interior to the face of each surface cell
+  const AmanziMesh::Entity_ID_List& top_cells =
+      BoundaryFacePlan::Get(sub_vector->Mesh()).Surface(result->Mesh()).cells;
+  for (int c=0; c!=top_cells.size(); ++c) {
+    result_cells[0][c] = sub_vector_cells[0][top_cells[c]];
   }
 }
 
@@ -7,6 +7,7 @@
   Authors: Ethan Coon (ecoon@lanl.gov)
 */
 
+#include "boundary_face_plan.hh"
 #include "top_cells_surface_evaluator.hh"
 
 namespace Amanzi {
@@ -40,18 +41,11 @@ TopCellsSurfaceEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   Epetra_MultiVector& result_cells = *result->ViewComponent("cell",false);
 
 
-  int ncells_surf = surf_vector->Mesh()->num_entities(AmanziMesh::CELL,
-          AmanziMesh::Parallel_type::OWNED);
-  for (unsigned int c=0; c!=ncells_surf; ++c) {
-    // get the face on the subsurface mesh
-    AmanziMesh::Entity_ID f = surf_vector->Mesh()->entity_get_parent(AmanziMesh::CELL, c);
-
-    // get the cell interior to the face
-    AmanziMesh::Entity_ID_List cells;
-    result->Mesh()->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-    AMANZI_ASSERT(cells.size() == 1);
-
-    result_cells[0][cells[0]] = surf_vector_cells[0][c];
+  // the cell interior to the face of each surface cell
+  const AmanziMesh::Entity_ID_List& top_cells =
+      BoundaryFacePlan::Get(result->Mesh()).Surface(surf_vector->Mesh()).cells;
+  for (int c=0; c!=top_cells.size(); ++c) {
+    result_cells[0][top_cells[c]] = surf_vector_cells[0][c];
   }
   if (negate_) result->Scale(-1);
 }
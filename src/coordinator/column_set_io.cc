@@ -0,0 +1,280 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! ColumnSetIO: aggregated checkpoint and vis output for column domain sets.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <sstream>
+#include <tuple>
+
+#include "errors.hh"
+#include "checkpoint.hh"
+#include "HDF5_MPI.hh"
+#include "TimeStepManager.hh"
+#include "State.hh"
+
+#include "column_set_io.hh"
+
+namespace ATS {
+
+ColumnSetIO::ColumnSetIO(Teuchos::ParameterList& plist,
+                         Epetra_MpiComm* comm,
+                         bool vis) :
+    plist_(plist),
+    comm_(comm),
+    vis_(vis)
+{
+  if (vis_) {
+    sets_.push_back(plist_.get<std::string>("column domain set", "column"));
+  } else {
+    Teuchos::Array<std::string> defaults(2);
+    defaults[0] = "column";
+    defaults[1] = "surface_column";
+    sets_ = plist_.get<Teuchos::Array<std::string> >("column domain sets", defaults).toVector();
+
+    // column data goes alongside, not on top of, the standard checkpoint
+    std::string base = plist_.get<std::string>("file name base", "checkpoint");
+    plist_.set("file name base", base+"_columns");
+  }
+  output_ = Teuchos::rcp(new Amanzi::Checkpoint(plist_, comm_));
+}
+
+
+// Is this domain of the form SET_GID for one of the aggregated sets?
+bool
+ColumnSetIO::IsColumnDomain_(const Amanzi::Key& domain, std::string& set, int& gid) const
+{
+  std::size_t pos = domain.rfind('_');
+  if (pos == std::string::npos || pos+1 == domain.size()) return false;
+
+  std::string prefix = domain.substr(0, pos);
+  if (std::find(sets_.begin(), sets_.end(), prefix) == sets_.end()) return false;
+
+  std::string id = domain.substr(pos+1);
+  if (!std::all_of(id.begin(), id.end(), [](char c) { return std::isdigit(c); })) return false;
+
+  set = prefix;
+  gid = std::stoi(id);
+  return true;
+}
+
+
+void
+ColumnSetIO::Setup(const Teuchos::Ptr<Amanzi::State>& S)
+{
+  // collect, by (set, variable, component), all columns and their GIDs
+  typedef std::tuple<std::string, Amanzi::Key, std::string> GroupKey;
+  std::map<GroupKey, std::vector<std::pair<int, Amanzi::Key> > > found;
+
+  for (Amanzi::State::field_iterator f=S->field_begin(); f!=S->field_end(); ++f) {
+    if (f->second->type() != Amanzi::COMPOSITE_FIELD_TYPE) continue;
+
+    std::string set;
+    int gid;
+    if (!IsColumnDomain_(Amanzi::Keys::getDomain(f->first), set, gid)) continue;
+    if (vis_ ? !f->second->io_vis() : !f->second->io_checkpoint()) continue;
+
+    Teuchos::RCP<const Amanzi::CompositeVector> cv = S->GetFieldData(f->first);
+    for (const auto& comp : *cv) {
+      found[std::make_tuple(set, Amanzi::Keys::getVarName(f->first), comp)]
+          .emplace_back(gid, f->first);
+    }
+
+    // written here instead, so remove it from the standard checkpoint
+    if (!vis_) f->second->set_io_checkpoint(false);
+  }
+
+  // Form the groups.  Note that every rank must create the same groups in
+  // the same order, as building maps is collective.  std::map iteration is
+  // ordered, but a rank with no columns of a given group would not know of
+  // it, so the group keys are made global first.
+  std::vector<GroupKey> local_keys;
+  for (const auto& entry : found) local_keys.push_back(entry.first);
+
+  std::string local_str;
+  for (const auto& gk : local_keys) {
+    local_str += std::get<0>(gk) + '\n' + std::get<1>(gk) + '\n' + std::get<2>(gk) + '\n';
+  }
+  int local_len = local_str.size();
+  std::vector<int> lens(comm_->NumProc()), displs(comm_->NumProc(), 0);
+  MPI_Allgather(&local_len, 1, MPI_INT, lens.data(), 1, MPI_INT, comm_->Comm());
+  for (int p=1; p<comm_->NumProc(); ++p) displs[p] = displs[p-1] + lens[p-1];
+  std::string all_str(displs.back() + lens.back(), '\0');
+  MPI_Allgatherv(&local_str[0], local_len, MPI_CHAR, &all_str[0], lens.data(),
+                 displs.data(), MPI_CHAR, comm_->Comm());
+
+  std::map<GroupKey, int> global_keys;
+  std::size_t pos = 0;
+  while (pos < all_str.size()) {
+    std::size_t p1 = all_str.find('\n', pos);
+    std::size_t p2 = all_str.find('\n', p1+1);
+    std::size_t p3 = all_str.find('\n', p2+1);
+    global_keys[std::make_tuple(all_str.substr(pos, p1-pos),
+                                all_str.substr(p1+1, p2-p1-1),
+                                all_str.substr(p2+1, p3-p2-1))] = 0;
+    pos = p3+1;
+  }
+
+  groups_.clear();
+  for (const auto& gk : global_keys) {
+    FieldGroup group;
+    std::tie(group.set, group.varname, group.component) = gk.first;
+
+    std::vector<std::pair<int, Amanzi::Key> > cols = found[gk.first];
+    std::sort(cols.begin(), cols.end());
+
+    std::vector<int> gids;
+    int ndofs_l = 0;
+    for (const auto& col : cols) {
+      Teuchos::RCP<const Amanzi::CompositeVector> cv = S->GetFieldData(col.second);
+      gids.push_back(col.first);
+      group.keys.push_back(col.second);
+      group.lengths.push_back(cv->size(group.component, false));
+      ndofs_l = std::max(ndofs_l, cv->NumVectors(group.component));
+    }
+    comm_->MaxAll(&ndofs_l, &group.ndofs, 1);
+
+    BuildMap_(group, gids);
+    group.data = Teuchos::rcp(new Epetra_MultiVector(*group.map, group.ndofs));
+    for (int i=0; i!=group.ndofs; ++i) {
+      std::stringstream name;
+      name << group.set << "-" << group.varname << "." << group.component << "." << i;
+      group.names.push_back(name.str());
+    }
+    groups_.push_back(group);
+  }
+}
+
+
+// Each column's entries are placed at an offset equal to the total length of
+// all columns of smaller GID, so the layout depends only on the columns, not
+// on their distribution.
+void
+ColumnSetIO::BuildMap_(FieldGroup& group, const std::vector<int>& gids) const
+{
+  int nprocs = comm_->NumProc();
+  std::vector<int> local;
+  for (int i=0; i!=gids.size(); ++i) {
+    local.push_back(gids[i]);
+    local.push_back(group.lengths[i]);
+  }
+
+  int nlocal = local.size();
+  std::vector<int> counts(nprocs), displs(nprocs, 0);
+  MPI_Allgather(&nlocal, 1, MPI_INT, counts.data(), 1, MPI_INT, comm_->Comm());
+  for (int p=1; p<nprocs; ++p) displs[p] = displs[p-1] + counts[p-1];
+  std::vector<int> all(displs.back() + counts.back());
+  MPI_Allgatherv(local.data(), nlocal, MPI_INT, all.data(), counts.data(),
+                 displs.data(), MPI_INT, comm_->Comm());
+
+  std::map<int,int> offsets;
+  for (int i=0; i<all.size(); i+=2) offsets[all[i]] = all[i+1];
+  int offset = 0;
+  for (auto& entry : offsets) {
+    int len = entry.second;
+    entry.second = offset;
+    offset += len;
+  }
+
+  std::vector<int> my_gids;
+  for (int i=0; i!=gids.size(); ++i) {
+    int start = offsets[gids[i]];
+    for (int k=0; k!=group.lengths[i]; ++k) my_gids.push_back(start + k);
+  }
+  group.map = Teuchos::rcp(new Epetra_Map(-1, my_gids.size(), my_gids.data(), 0, *comm_));
+}
+
+
+void
+ColumnSetIO::RegisterWithTimeStepManager(const Teuchos::Ptr<Amanzi::TimeStepManager>& tsm)
+{
+  output_->RegisterWithTimeStepManager(tsm);
+}
+
+
+bool
+ColumnSetIO::DumpRequested(int cycle, double time)
+{
+  return output_->DumpRequested(cycle, time);
+}
+
+
+void
+ColumnSetIO::Write(const Amanzi::State& S, double dt)
+{
+  output_->CreateFile(S.cycle());
+  for (auto& group : groups_) {
+    int pos = 0;
+    for (int j=0; j!=group.keys.size(); ++j) {
+      const Epetra_MultiVector& col =
+          *S.GetFieldData(group.keys[j])->ViewComponent(group.component, false);
+      for (int i=0; i!=col.NumVectors(); ++i) {
+        for (int k=0; k!=group.lengths[j]; ++k) (*group.data)[i][pos+k] = col[i][k];
+      }
+      pos += group.lengths[j];
+    }
+    output_->WriteVector(*group.data, group.names);
+  }
+  output_->WriteAttributes(S.time(), dt, S.cycle(), S.position());
+  output_->Finalize();
+}
+
+
+void
+ColumnSetIO::set_filebasename(const std::string& base)
+{
+  output_->set_filebasename(base+"_columns");
+}
+
+
+void
+ColumnSetIO::Read(const Teuchos::Ptr<Amanzi::State>& S, const std::string& filename)
+{
+  Amanzi::HDF5_MPI reader(*comm_, filename);
+  reader.open_h5file();
+  for (auto& group : groups_) {
+    for (int i=0; i!=group.ndofs; ++i) {
+      reader.readData(*(*group.data)(i), group.names[i]);
+    }
+
+    int pos = 0;
+    for (int j=0; j!=group.keys.size(); ++j) {
+      Amanzi::Key owner = S->GetField(group.keys[j])->owner();
+      Epetra_MultiVector& col =
+          *S->GetFieldData(group.keys[j], owner)->ViewComponent(group.component, false);
+      for (int i=0; i!=col.NumVectors(); ++i) {
+        for (int k=0; k!=group.lengths[j]; ++k) col[i][k] = (*group.data)[i][pos+k];
+      }
+      S->GetField(group.keys[j], owner)->set_initialized();
+      pos += group.lengths[j];
+    }
+  }
+  reader.close_h5file();
+}
+
+
+// checkpoint00100.h5 --> checkpoint_columns00100.h5
+std::string
+ColumnSetIO::ColumnFilename(const std::string& filename)
+{
+  std::string stem = filename;
+  std::string ext;
+  std::size_t dot = stem.rfind(".h5");
+  if (dot != std::string::npos && dot + 3 == stem.size()) {
+    ext = ".h5";
+    stem = stem.substr(0, dot);
+  }
+  std::size_t digits = stem.size();
+  while (digits > 0 && std::isdigit(stem[digits-1])) --digits;
+  return stem.substr(0, digits) + "_columns" + stem.substr(digits) + ext;
+}
+
+} // namespace ATS
@@ -0,0 +1,126 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! ColumnSetIO: aggregated checkpoint and vis output for column domain sets.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*!
+
+Column runs have one mesh per surface cell, each on MPI_COMM_SELF.  Writing
+these through the standard Checkpoint and Visualization objects results in
+one file per column (vis) or one file per rank (checkpoints).  ColumnSetIO
+instead gathers, for each variable of a domain set, every column's values
+into a single dataset on the global communicator, ordered by column GID.
+Restarting reads this layout back, and is therefore independent of the
+number of ranks used to write it.
+
+Datasets are named `"SET-VARNAME.COMPONENT.DOF`", e.g.
+`"column-pressure.cell.0`", and are laid out as column GID-ordered
+concatenations of each column's entries.
+
+This is enabled by adding, to the `"checkpoint`" list:
+
+* `"aggregate column domain sets`" ``[bool]`` **false** If true, write all
+  column domain set fields into a single file per checkpoint.
+
+* `"column domain sets`" ``[Array(string)]`` **{column, surface_column}**
+  Names of the domain sets to aggregate.
+
+or, for a domain set in the `"visualization`" list (e.g. `"column_*`"):
+
+* `"aggregate columns`" ``[bool]`` **false** If true, write all columns into
+  a single file per visualization dump.
+
+Aggregated visualization files are data only: they hold the datasets above,
+in the same layout as checkpoints, but no mesh and no XDMF, so they are meant
+for post-processing scripts (e.g. with h5py) rather than VisIt or ParaView.
+When all columns have the same number of cells n, the column of the i-th
+smallest GID occupies entries [i*n, (i+1)*n) of each dataset.
+
+Error checkpoints (`"last_good_checkpoint`" and `"error_checkpoint`") also
+write their column data, to files named as for ColumnFilename().
+
+*/
+
+#ifndef ATS_COLUMN_SET_IO_HH_
+#define ATS_COLUMN_SET_IO_HH_
+
+#include <string>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Epetra_MpiComm.h"
+#include "Epetra_Map.h"
+#include "Epetra_MultiVector.h"
+
+#include "Key.hh"
+
+namespace Amanzi {
+class State;
+class Checkpoint;
+class TimeStepManager;
+};
+
+namespace ATS {
+
+class ColumnSetIO {
+
+ public:
+  // If vis is true, fields flagged for vis are written, otherwise fields
+  // flagged for checkpointing are written.
+  ColumnSetIO(Teuchos::ParameterList& plist,
+              Epetra_MpiComm* comm,
+              bool vis);
+
+  // Find all column fields, build the aggregated maps, and remove those
+  // fields from the standard (per-column or per-rank) output.  Must be called
+  // after State::Setup().
+  void Setup(const Teuchos::Ptr<Amanzi::State>& S);
+
+  void RegisterWithTimeStepManager(const Teuchos::Ptr<Amanzi::TimeStepManager>& tsm);
+  bool DumpRequested(int cycle, double time);
+
+  void Write(const Amanzi::State& S, double dt);
+
+  // Base of the file name, to which "_columns" is appended.
+  void set_filebasename(const std::string& base);
+  void Read(const Teuchos::Ptr<Amanzi::State>& S, const std::string& filename);
+
+  // Name of the column file accompanying a standard checkpoint file.
+  static std::string ColumnFilename(const std::string& filename);
+
+ protected:
+  // All columns of a domain set which carry a given variable and component.
+  struct FieldGroup {
+    std::string set;
+    Amanzi::Key varname;
+    std::string component;
+    int ndofs;
+    std::vector<Amanzi::Key> keys;   // in increasing column GID order
+    std::vector<int> lengths;
+    Teuchos::RCP<Epetra_Map> map;
+    Teuchos::RCP<Epetra_MultiVector> data;
+    std::vector<std::string> names;
+  };
+
+  bool IsColumnDomain_(const Amanzi::Key& domain, std::string& set, int& gid) const;
+  void BuildMap_(FieldGroup& group, const std::vector<int>& gids) const;
+
+ protected:
+  Teuchos::ParameterList plist_;
+  Epetra_MpiComm* comm_;
+  bool vis_;
+  std::vector<std::string> sets_;
+  std::vector<FieldGroup> groups_;
+  Teuchos::RCP<Amanzi::Checkpoint> output_;
+};
+
+} // namespace ATS
+
+#endif
@@ -30,8 +30,11 @@ including Vis and restart/checkpoint dumps.  It contains one and only one PK
 #include "PK.hh"
 #include "TreeVector.hh"
 #include "PK_Factory.hh"
+#include "region_entity_cache.hh"
 //#include "pk_factory_ats.hh"
 
+#include "column_set_io.hh"
+#include "profile_report.hh"
 #include "coordinator.hh"
 
 #define DEBUG_MODE 1
@@ -79,8 +82,14 @@ void Coordinator::coordinator_init() {
   int rank = comm_->MyPID();
   int size = comm_->NumProc();
   std::stringstream check;
+
+  // Column runs either checkpoint per rank, or aggregate all columns into a
+  // single, rank-independent file alongside the standard checkpoint.
+  bool columns = parameter_list_->sublist("mesh").isSublist("column");
+  bool aggregate_columns = parameter_list_->isSublist("checkpoint") &&
+      parameter_list_->sublist("checkpoint").get<bool>("aggregate column domain sets", false);
   
-  if(parameter_list_->sublist("mesh").isSublist("column"))  
+  if(columns && !aggregate_columns)
     check << "checkpoint " << rank;
   else
     check << "checkpoint";
@@ -88,7 +97,10 @@ void Coordinator::coordinator_init() {
   // create the checkpointing
 
   Teuchos::ParameterList& chkp_plist = parameter_list_->sublist(check.str());
-  if (parameter_list_->sublist("mesh").isSublist("column") && size >1){
+  if (aggregate_columns) {
+    column_checkpoint_ = Teuchos::rcp(new ColumnSetIO(chkp_plist, comm_, false));
+  }
+  if (columns && size >1 && !aggregate_columns){
     MPI_Comm mpi_comm_self(MPI_COMM_SELF);
     Epetra_MpiComm *comm_self = new Epetra_MpiComm(mpi_comm_self);
     checkpoint_ = Teuchos::rcp(new Amanzi::Checkpoint(chkp_plist, comm_self));
@@ -126,7 +138,12 @@ void Coordinator::coordinator_init() {
   }
   // create the time step manager
   tsm_ = Teuchos::rcp(new Amanzi::TimeStepManager());
-  
+
+  // timing and memory report
+  if (coordinator_list_->get<bool>("write profile", false)) {
+    profile_report_ = Teuchos::rcp(new ProfileReport(
+        coordinator_list_->get<std::string>("profile filename", "ats_profile.yaml"), comm_));
+  }
 }
 
 void Coordinator::setup() {
@@ -137,6 +154,10 @@ void Coordinator::setup() {
 
   pk_->Setup(S_.ptr());  
   S_->Setup();
+
+  // column fields are removed from the standard checkpoint here, so this
+  // must happen before any restart is read
+  if (column_checkpoint_ != Teuchos::null) column_checkpoint_->Setup(S_.ptr());
 }
 
 void Coordinator::initialize() {
@@ -153,11 +174,13 @@ void Coordinator::initialize() {
   // -- BDF history to allow projection to continue correctly.
 
   int size = comm_->NumProc();
+  bool per_rank_columns = parameter_list_->sublist("mesh").isSublist("column") &&
+      column_checkpoint_ == Teuchos::null;
 
 
   //---
   if (restart_) {
-    if (parameter_list_->sublist("mesh").isSublist("column") && size >1){
+    if (per_rank_columns && size >1){
       MPI_Comm mpi_comm_self(MPI_COMM_SELF);
       Epetra_MpiComm *comm_self = new Epetra_MpiComm(mpi_comm_self);
       t0_ = Amanzi::ReadCheckpointInitialTime(comm_self, restart_filename_);
@@ -171,7 +194,7 @@ void Coordinator::initialize() {
 
   // Restart from checkpoint, part 2.
   if (restart_) {
-    if (parameter_list_->sublist("mesh").isSublist("column") && size >1){
+    if (per_rank_columns && size >1){
       MPI_Comm mpi_comm_self(MPI_COMM_SELF);
       Epetra_MpiComm *comm_self = new Epetra_MpiComm(mpi_comm_self);
       ReadCheckpoint(comm_self, S_.ptr(), restart_filename_);
@@ -183,6 +206,10 @@ void Coordinator::initialize() {
       t0_ = S_->time();
       cycle0_ = S_->cycle();
     }
+
+    if (column_checkpoint_ != Teuchos::null) {
+      column_checkpoint_->Read(S_.ptr(), ColumnSetIO::ColumnFilename(restart_filename_));
+    }
     
     for (Amanzi::State::mesh_iterator mesh=S_->mesh_begin();
          mesh!=S_->mesh_end(); ++mesh) {
@@ -249,6 +276,18 @@ void Coordinator::initialize() {
     
       visualization_.push_back(vis);
 
+    } else if (boost::ends_with(domain_name, "_*") &&
+               vis_list->sublist(domain_name).get<bool>("aggregate columns", false)) {
+      // visualize domain set, all columns in one file per dump
+      std::string domain_set_name = domain_name.substr(0,domain_name.size()-2);
+      Teuchos::ParameterList sublist = vis_list->sublist(domain_name);
+      sublist.set<std::string>("column domain set", domain_set_name);
+      if (!sublist.isParameter("file name base"))
+        sublist.set<std::string>("file name base", std::string("visdump_")+domain_set_name+"_columns");
+      auto vis = Teuchos::rcp(new ColumnSetIO(sublist, comm_, true));
+      vis->Setup(S_.ptr());
+      column_visualization_.push_back(vis);
+
     } else if (boost::ends_with(domain_name, "_*")) {
       // visualize domain set
       std::string domain_set_name = domain_name.substr(0,domain_name.size()-2);
@@ -280,6 +319,7 @@ void Coordinator::initialize() {
        vis!=visualization_.end(); ++vis) {
     (*vis)->RegisterWithTimeStepManager(tsm_.ptr());
   }
+  for (auto& vis : column_visualization_) vis->RegisterWithTimeStepManager(tsm_.ptr());
 
   // -- register checkpoint times
   checkpoint_->RegisterWithTimeStepManager(tsm_.ptr());
@@ -322,6 +362,7 @@ void Coordinator::finalize() {
   if (!checkpoint_->DumpRequested(S_next_->cycle(), S_next_->time())) {
     pk_->CalculateDiagnostics(S_next_);
     WriteCheckpoint(checkpoint_.ptr(), S_next_.ptr(), 0.0);
+    if (column_checkpoint_ != Teuchos::null) column_checkpoint_->Write(*S_next_, 0.0);
   }
 
   // flush observations to make sure they are saved
@@ -552,7 +593,7 @@ bool Coordinator::advance(double t_old, double t_new) {
           
           // undeform the mesh
           Amanzi::AmanziGeometry::Point_List final_positions;
-          mesh->second.first->deform(node_ids, old_positions, false, &final_positions);
+          Amanzi::DeformMeshAndCaches(*mesh->second.first, node_ids, old_positions, false, &final_positions);
         }
         
         else if (!parameter_list_->sublist("mesh").isSublist("column")) {
@@ -580,7 +621,7 @@ bool Coordinator::advance(double t_old, double t_new) {
           
           // undeform the mesh
           Amanzi::AmanziGeometry::Point_List final_positions;
-          mesh->second.first->deform(node_ids, old_positions, false, &final_positions);
+          Amanzi::DeformMeshAndCaches(*mesh->second.first, node_ids, old_positions, false, &final_positions);
         }
         
       }
@@ -601,6 +642,9 @@ void Coordinator::visualize(bool force) {
         dump = true;
       }
     }
+    for (auto& vis : column_visualization_) {
+      if (vis->DumpRequested(S_next_->cycle(), S_next_->time())) dump = true;
+    }
   }
 
   if (dump) {
@@ -613,11 +657,18 @@ void Coordinator::visualize(bool force) {
       WriteVis((*vis).ptr(), S_next_.ptr());
     }
   }
+  for (auto& vis : column_visualization_) {
+    if (force || vis->DumpRequested(S_next_->cycle(), S_next_->time())) {
+      vis->Write(*S_next_, 0.0);
+    }
+  }
 }
 
 void Coordinator::checkpoint(double dt, bool force) {
   if (force || checkpoint_->DumpRequested(S_next_->cycle(), S_next_->time())) {
     WriteCheckpoint(checkpoint_.ptr(), S_next_.ptr(), dt);
+    if (column_checkpoint_ != Teuchos::null) column_checkpoint_->Write(*S_next_, dt);
+    if (profile_report_ != Teuchos::null) profile_report_->Write(*S_next_);
   }
 }
 
@@ -700,8 +751,16 @@ void Coordinator::cycle_driver() {
     // and one as a "debugging data" checkpoint.
     checkpoint_->set_filebasename("last_good_checkpoint");
     WriteCheckpoint(checkpoint_.ptr(), S_.ptr(), dt);
+    if (column_checkpoint_ != Teuchos::null) {
+      column_checkpoint_->set_filebasename("last_good_checkpoint");
+      column_checkpoint_->Write(*S_, dt);
+    }
     checkpoint_->set_filebasename("error_checkpoint");
     WriteCheckpoint(checkpoint_.ptr(), S_next_.ptr(), dt);
+    if (column_checkpoint_ != Teuchos::null) {
+      column_checkpoint_->set_filebasename("error_checkpoint");
+      column_checkpoint_->Write(*S_next_, dt);
+    }
     throw e;
   }
 #endif
@@ -712,6 +771,7 @@ void Coordinator::cycle_driver() {
   S_->WriteStatistics(vo_);  
   report_memory();
   Teuchos::TimeMonitor::summarize(*vo_->os());
+  if (profile_report_ != Teuchos::null) profile_report_->Write(*S_next_);
 
   finalize();
 
@@ -90,6 +90,9 @@ class UnstructuredObservations;
 
 namespace ATS {
 
+class ColumnSetIO;
+class ProfileReport;
+
 class Coordinator {
 
 public:
@@ -147,12 +150,17 @@ private:
   std::vector<Teuchos::RCP<Amanzi::Visualization> > visualization_;
   std::vector<Teuchos::RCP<Amanzi::Visualization> > failed_visualization_;
   Teuchos::RCP<Amanzi::Checkpoint> checkpoint_;
+  std::vector<Teuchos::RCP<ColumnSetIO> > column_visualization_;
+  Teuchos::RCP<ColumnSetIO> column_checkpoint_;
   bool restart_;
   std::string restart_filename_;
 
   // observations
   Teuchos::RCP<Amanzi::UnstructuredObservations> observations_;
 
+  // timing and memory report
+  Teuchos::RCP<ProfileReport> profile_report_;
+
   // timers
   Teuchos::RCP<Teuchos::Time> setup_timer_;
   Teuchos::RCP<Teuchos::Time> cycle_timer_;
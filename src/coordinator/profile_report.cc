@@ -0,0 +1,138 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! ProfileReport: machine-readable timing and memory report.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+#include "Teuchos_oblackholestream.hpp"
+#include "Teuchos_TimeMonitor.hpp"
+
+#include "errors.hh"
+#include "State.hh"
+
+#include "profile_report.hh"
+
+namespace ATS {
+
+double rss_usage(); // in coordinator.cc
+
+ProfileReport::ProfileReport(const std::string& filename, Epetra_MpiComm* comm) :
+    filename_(filename),
+    comm_(comm) {}
+
+
+Amanzi::Key
+ProfileReport::SetName(const Amanzi::Key& key)
+{
+  Amanzi::Key domain = Amanzi::Keys::getDomain(key);
+  std::size_t pos = domain.rfind('_');
+  if (pos == std::string::npos || pos+1 == domain.size()) return key;
+  if (!std::all_of(domain.begin()+pos+1, domain.end(), [](char c) { return std::isdigit(c); }))
+    return key;
+  return Amanzi::Keys::getKey(domain.substr(0, pos+1) + "*", Amanzi::Keys::getVarName(key));
+}
+
+
+void
+ProfileReport::Write(const Amanzi::State& S)
+{
+  // local bytes per field (or per domain set field)
+  std::map<Amanzi::Key, double> local;
+  for (Amanzi::State::field_iterator f=S.field_begin(); f!=S.field_end(); ++f) {
+    local[SetName(f->first)] += sizeof(double) * f->second->GetLocalElementCount();
+  }
+
+  // Ranks need not hold the same fields (e.g. columns), so rather than
+  // reducing field by field, rank 0 gathers everything as "name<tab>bytes" lines.
+  std::stringstream local_ss;
+  local_ss.precision(17);
+  for (const auto& entry : local) local_ss << entry.first << "\t" << entry.second << "\n";
+  std::string local_str = local_ss.str();
+
+  int nprocs = comm_->NumProc();
+  int local_len = local_str.size();
+  std::vector<int> lens(nprocs), displs(nprocs, 0);
+  MPI_Gather(&local_len, 1, MPI_INT, lens.data(), 1, MPI_INT, 0, comm_->Comm());
+  for (int p=1; p<nprocs; ++p) displs[p] = displs[p-1] + lens[p-1];
+  std::string all_str(comm_->MyPID() == 0 ? displs.back() + lens.back() : 0, '\0');
+  MPI_Gatherv(&local_str[0], local_len, MPI_CHAR, &all_str[0], lens.data(),
+              displs.data(), MPI_CHAR, 0, comm_->Comm());
+
+  double mem = rss_usage();
+  double mem_min(0.), mem_max(0.), mem_total(0.);
+  comm_->MinAll(&mem, &mem_min, 1);
+  comm_->MaxAll(&mem, &mem_max, 1);
+  comm_->SumAll(&mem, &mem_total, 1);
+
+  std::ofstream file;
+  int ok = 1;
+  if (comm_->MyPID() == 0) {
+    file.open(filename_.c_str());
+    ok = file.good() ? 1 : 0;
+  }
+  comm_->Broadcast(&ok, 1, 0);
+  if (!ok) {
+    Errors::Message msg;
+    msg << "ProfileReport: cannot open \"" << filename_ << "\" for writing.";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  Teuchos::oblackholestream blackhole;
+  std::ostream* os = &blackhole;
+  if (comm_->MyPID() == 0) {
+    os = &file;
+
+    std::map<Amanzi::Key, std::pair<double,double> > fields; // total, max
+    std::stringstream all_ss(all_str);
+    std::string line;
+    while (std::getline(all_ss, line)) {
+      std::size_t tab = line.rfind('\t');
+      double bytes = std::stod(line.substr(tab+1));
+      auto& entry = fields[line.substr(0, tab)];
+      entry.first += bytes;
+      entry.second = std::max(entry.second, bytes);
+    }
+
+    double fields_total = 0.;
+    for (const auto& entry : fields) fields_total += entry.second.first;
+
+    file << std::fixed << std::setprecision(1)
+         << "---\n"
+         << "Cycle: " << S.cycle() << "\n"
+         << "Time [s]: " << S.time() << "\n"
+         << "Number of processes: " << nprocs << "\n"
+         << "Memory high water mark [MB]:\n"
+         << "  Minimum per process: " << mem_min << "\n"
+         << "  Maximum per process: " << mem_max << "\n"
+         << "  Total: " << mem_total << "\n"
+         << "Field memory [bytes]:\n"
+         << "  Total: " << fields_total << "\n"
+         << "  Fields:\n";
+    for (const auto& entry : fields) {
+      file << "    \"" << entry.first << "\": {Total: " << entry.second.first
+           << ", Maximum per process: " << entry.second.second << "}\n";
+    }
+    file << "...\n";
+  }
+
+  // collective
+  Teuchos::RCP<Teuchos::ParameterList> params = Teuchos::rcp(
+      new Teuchos::ParameterList(*Teuchos::TimeMonitor::getValidReportParameters()));
+  params->set("Report format", "YAML");
+  params->set("YAML style", "spacious");
+  Teuchos::TimeMonitor::report(*os, "", params);
+}
+
+} // namespace ATS
@@ -0,0 +1,71 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! ProfileReport: machine-readable timing and memory report.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*!
+
+Writes a YAML file describing where the time and memory of a run go.  The
+file holds two documents:
+
+1. Memory: the high water mark of each rank, and for each field in State the
+   bytes held, summed and maximized over ranks.  Fields on domain sets are
+   combined, e.g. all `"column_*-temperature`".
+
+2. Timers: the Teuchos timer report, including wallclock times and call
+   counts of every PK's AdvanceStep and, within strongly coupled MPCs, of each
+   sub-PK's FunctionalResidual, ApplyPreconditioner, and
+   UpdatePreconditioner.  See PKTimer_.
+
+The report is written at every checkpoint and at the end of the run,
+overwriting the previous one.
+
+In the `"cycle driver`" list:
+
+* `"write profile`" ``[bool]`` **false** Write the profile report.
+
+* `"profile filename`" ``[string]`` **ats_profile.yaml** Name of the report.
+
+*/
+
+#ifndef ATS_PROFILE_REPORT_HH_
+#define ATS_PROFILE_REPORT_HH_
+
+#include <string>
+
+#include "Epetra_MpiComm.h"
+
+#include "Key.hh"
+
+namespace Amanzi {
+class State;
+};
+
+namespace ATS {
+
+class ProfileReport {
+
+ public:
+  ProfileReport(const std::string& filename, Epetra_MpiComm* comm);
+
+  // Collective.
+  void Write(const Amanzi::State& S);
+
+  // Name used to combine fields of a domain set, "column_12-temperature"
+  // --> "column_*-temperature".
+  static Amanzi::Key SetName(const Amanzi::Key& key);
+
+ protected:
+  std::string filename_;
+  Epetra_MpiComm* comm_;
+};
+
+} // namespace ATS
+
+#endif
@@ -185,28 +185,71 @@ createMesh(Teuchos::ParameterList& mesh_plist,
 
     // etc: Note that this explicitly and purposefully leaks the comm's
     // memory.  This is due to poor design of the mesh infrastructure, where a
-    // bare pointer is stored instead of a reference counted pointer.  
-    Teuchos::RCP<Epetra_MpiComm> comm_self =
+    // bare pointer is stored instead of a reference counted pointer.  It is
+    // leaked once per process and shared by all subgrid meshes, rather than
+    // once per subgrid set.
+    static Teuchos::RCP<Epetra_MpiComm> comm_self =
         Teuchos::rcpFromRef(*(new Epetra_MpiComm(MPI_COMM_SELF)));
     
     // for each id in the regions of the parent mesh on entity, create a subgrid mesh
     Amanzi::AmanziMesh::Entity_ID_List entities;
     parent_mesh->get_set_entities(regionname, kind, Amanzi::AmanziMesh::Parallel_type::OWNED, &entities);
     const Epetra_Map& map = parent_mesh->map(kind,false);
-    
+
+    // The generic list is looked up once and shared by every entity which
+    // does not provide its own list.
+    std::string subgrid_name = Amanzi::Keys::cleanPListName(mesh_plist.name());
+    bool has_generic = subgrid.isSublist(subgrid_name+"_*");
+    Teuchos::ParameterList generic_empty;
+    Teuchos::ParameterList& generic_list = has_generic ?
+        subgrid.sublist(subgrid_name+"_*") : generic_empty;
+    std::string generic_type = generic_list.get<std::string>("mesh type", "");
+    bool generic_deformable = generic_list.get<bool>("deformable mesh", false);
+    bool generic_verify = generic_list.get<bool>("verify mesh", false);
+
+    // In flyweight mode, columns without an entity-specific list are
+    // constructed directly from the shared generic list, skipping the
+    // per-entity ParameterList copy and recursion through createMesh().
+    bool direct = flyweight && !generic_verify &&
+                  (generic_type == "column" || generic_type == "column surface");
+    std::string column_parent_name;
+    std::string column_surface_setname;
+    if (direct && generic_type == "column") {
+      column_parent_name = generic_list.sublist("column parameters")
+                           .get<std::string>("parent domain", parent_domain_name);
+    } else if (direct) {
+      column_surface_setname = generic_list.sublist("column surface parameters")
+                               .get<std::string>("subgrid set name", "surface");
+    }
+    Teuchos::RCP<const Amanzi::AmanziMesh::Mesh> column_parent = column_parent_name.empty() ?
+        Teuchos::null : S.GetMesh(column_parent_name);
+
+    std::string name_prefix = subgrid_name + "_";
     for (auto lid : entities) {
       Amanzi::AmanziMesh::Entity_ID gid = map.GID(lid);
-      std::stringstream name;
-      name << Amanzi::Keys::cleanPListName(mesh_plist.name()) << "_" << gid;
+      std::string name = name_prefix + std::to_string(gid);
+
+      if (direct && !subgrid.isSublist(name)) {
+        Teuchos::RCP<Amanzi::AmanziMesh::Mesh> mesh;
+        if (generic_type == "column") {
+          mesh = Teuchos::rcp(new Amanzi::AmanziMesh::MeshColumn(*column_parent, lid));
+        } else {
+          std::size_t pos = name.find('_');
+          auto parent = S.GetMesh(name.substr(pos+1, name.size()));
+          mesh = Teuchos::rcp(new Amanzi::AmanziMesh::MeshSurfaceCell(*parent, column_surface_setname));
+        }
+        S.RegisterMesh(name, mesh, generic_deformable);
+        continue;
+      }
 
       Teuchos::ParameterList subgrid_i_list;
-      if (subgrid.isSublist(name.str())) {
-        subgrid_i_list = subgrid.sublist(name.str());
+      if (subgrid.isSublist(name)) {
+        subgrid_i_list = subgrid.sublist(name);
       } else {
-        subgrid_i_list = subgrid.sublist(Amanzi::Keys::cleanPListName(mesh_plist.name())+"_*");
+        subgrid_i_list = subgrid.sublist(subgrid_name+"_*");
       }
 
-      subgrid_i_list.setName(name.str());
+      subgrid_i_list.setName(name);
       Teuchos::ParameterList& subgrid_i_param_list = subgrid_i_list.sublist(
           subgrid_i_list.get<std::string>("mesh type")+" parameters");
       if (!subgrid_i_param_list.isParameter("entity kind"))
@@ -353,7 +396,8 @@ createMeshes(Teuchos::ParameterList& global_list,
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
   //generalize checkpoint files for columns
-  if(global_list.isSublist("checkpoints") && global_list.sublist("mesh").isSublist("column")){
+  if(global_list.isSublist("checkpoints") && global_list.sublist("mesh").isSublist("column") &&
+     !global_list.sublist("checkpoints").get<bool>("aggregate column domain sets", false)){
   Teuchos::ParameterList& checkpoint_plist = global_list.sublist("checkpoints");
     std::stringstream name_check;
     name_check << rank;
@@ -364,6 +408,10 @@ createMeshes(Teuchos::ParameterList& global_list,
     global_list.set("checkpoint " +name_check.str(), checkpoint_plist);
     global_list.remove("checkpoints");
         
+  } else if (global_list.isSublist("checkpoints") && global_list.sublist("mesh").isSublist("column")) {
+    // aggregated column checkpoints are a single, global checkpoint
+    global_list.set("checkpoint", global_list.sublist("checkpoints"));
+    global_list.remove("checkpoints");
   }
   
   
@@ -184,7 +184,11 @@ Specified by `"mesh type`" of `"subgrid`".
 * `"entity kind`" ``[string]`` One of `"cell`", `"face`", etc.  Entity of the region (usually
    `"cell`") on which each subgrid mesh will be associated.
 * `"parent domain`" ``[string]`` **domain** Mesh which includes the above region.
-* `"flyweight mesh`" ``[bool]`` **False** NOT SUPPORTED?  Allows a single mesh instead of one per entity.
+* `"flyweight mesh`" ``[bool]`` **False** If true, and the generic subgrid mesh is a
+   `"column`" or `"column surface`" mesh, each column is constructed directly
+   from the shared generic list rather than from a per-entity copy of it.
+   Entities with their own sublist, or a generic list requesting `"verify
+   mesh`", are always constructed through the standard path.
 
     
 ColumnMeshes
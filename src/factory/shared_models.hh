@@ -0,0 +1,68 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/* -------------------------------------------------------------------------
+
+   ATS
+   Author: Ethan Coon
+
+   Sharing of constitutive models between evaluators.
+
+   Models created by the factories are immutable once constructed, so any
+   two evaluators whose model parameters are the same may use the same
+   instance.  This matters for domain sets: with one evaluator per column,
+   every column would otherwise construct (and hold a parameter list copy
+   in) its own WRMs, EOS, thermal conductivity models, etc.
+
+   Usage, where the list passed excludes anything not used by the model
+   itself (e.g. the "region" of a region-based model):
+
+     Teuchos::RCP<EOS> eos = SharedModels<EOS>::Get(eos_plist,
+             [&]() { return eos_fac.createEOS(eos_plist); });
+
+   The list is copied before the model is created, as model constructors may
+   add defaults to it.  Models built on top of another shared object (e.g. a
+   permafrost model wrapping a WRM) pass that object as the tag, so they are
+   shared only if both match.
+   ------------------------------------------------------------------------- */
+
+#ifndef _ATS_SHARED_MODELS_HH_
+#define _ATS_SHARED_MODELS_HH_
+
+#include <tuple>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+
+namespace Amanzi {
+namespace Utils {
+
+template<typename TBase>
+class SharedModels {
+
+public:
+  typedef std::tuple<Teuchos::ParameterList, const void*, Teuchos::RCP<TBase> > entry_type;
+
+  template<typename TCreate>
+  static Teuchos::RCP<TBase> Get(const Teuchos::ParameterList& plist, TCreate create,
+                                 const void* tag=nullptr) {
+    for (const auto& entry : Models_()) {
+      if (std::get<1>(entry) == tag && Teuchos::haveSameValues(std::get<0>(entry), plist))
+        return std::get<2>(entry);
+    }
+    Teuchos::ParameterList key(plist);
+    Teuchos::RCP<TBase> model = create();
+    Models_().emplace_back(key, tag, model);
+    return model;
+  }
+
+private:
+  static std::vector<entry_type>& Models_() {
+    static std::vector<entry_type> models;
+    return models;
+  }
+};
+
+} // namespace
+} // namespace
+
+#endif
@@ -0,0 +1,110 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// Split-phase master-to-ghost communication of a cell or face component.
+// -----------------------------------------------------------------------------
+
+#include "Epetra_Distributor.h"
+
+#include "dbc.hh"
+#include "errors.hh"
+#include "SplitPhaseScatter.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+SplitPhaseScatter::SplitPhaseScatter(const Epetra_BlockMap& owned_map,
+        const Epetra_BlockMap& ghosted_map) :
+    nowned_(owned_map.NumMyElements()),
+    nghost_(ghosted_map.NumMyElements() - owned_map.NumMyElements()),
+    nvecs_(0),
+    owned_(NULL),
+    in_progress_(false),
+    imports_(NULL),
+    len_imports_(0)
+{
+  if (owned_map.Comm().NumProc() > 1) {
+    importer_ = Teuchos::rcp(new Epetra_Import(ghosted_map, owned_map));
+
+    // Owned entries are the leading entries of the ghosted map, so the only
+    // received entries are ghosts and nothing needs to be permuted.
+    AMANZI_ASSERT(importer_->NumSameIDs() == nowned_);
+    AMANZI_ASSERT(importer_->NumPermuteIDs() == 0);
+    AMANZI_ASSERT(importer_->NumRemoteIDs() == nghost_);
+  }
+}
+
+
+SplitPhaseScatter::~SplitPhaseScatter() {
+  if (imports_ != NULL) delete [] imports_;
+}
+
+
+void SplitPhaseScatter::Begin(const Epetra_MultiVector& vec) {
+  AMANZI_ASSERT(!in_progress_);
+  AMANZI_ASSERT(vec.MyLength() >= nowned_);
+  nvecs_ = vec.NumVectors();
+  owned_ = vec.Pointers();
+  in_progress_ = true;
+  if (!IsParallel_()) return;
+
+  // pack the owned values requested by other ranks, entity-major
+  int nexports = importer_->NumExportIDs();
+  const int* export_lids = importer_->ExportLIDs();
+  exports_.resize(nexports * nvecs_ + 1);
+  for (int n=0; n!=nexports; ++n) {
+    for (int i=0; i!=nvecs_; ++i) {
+      exports_[n*nvecs_ + i] = owned_[i][export_lids[n]];
+    }
+  }
+
+  int ierr = importer_->Distributor().DoPosts(reinterpret_cast<char*>(&exports_[0]),
+          nvecs_ * sizeof(double), len_imports_, imports_);
+  if (ierr) {
+    Errors::Message msg("SplitPhaseScatter: failed to post ghost exchange.");
+    Exceptions::amanzi_throw(msg);
+  }
+}
+
+
+void SplitPhaseScatter::End(const Teuchos::Ptr<Epetra_MultiVector>& ghosted) {
+  AMANZI_ASSERT(in_progress_);
+  in_progress_ = false;
+  if (!IsParallel_()) return;
+
+  int ierr = importer_->Distributor().DoWaits();
+  if (ierr) {
+    Errors::Message msg("SplitPhaseScatter: failed to complete ghost exchange.");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  // unpack into ghost storage, ordered by local id
+  int nremote = importer_->NumRemoteIDs();
+  const int* remote_lids = importer_->RemoteLIDs();
+  const double* imports = reinterpret_cast<const double*>(imports_);
+  ghosts_.resize(nghost_ * nvecs_);
+  for (int n=0; n!=nremote; ++n) {
+    int g = remote_lids[n] - nowned_;
+    for (int i=0; i!=nvecs_; ++i) {
+      ghosts_[g*nvecs_ + i] = imports[n*nvecs_ + i];
+    }
+  }
+
+  if (ghosted != Teuchos::null) {
+    AMANZI_ASSERT(ghosted->MyLength() == nowned_ + nghost_);
+    AMANZI_ASSERT(ghosted->NumVectors() == nvecs_);
+    for (int g=0; g!=nghost_; ++g) {
+      for (int i=0; i!=nvecs_; ++i) {
+        (*ghosted)[i][nowned_ + g] = ghosts_[g*nvecs_ + i];
+      }
+    }
+  }
+}
+
+} // namespace
+} // namespace
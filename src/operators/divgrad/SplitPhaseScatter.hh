@@ -0,0 +1,96 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// Split-phase master-to-ghost communication of a cell or face component.
+//
+// Begin() packs the owned values needed by other ranks and posts the
+// nonblocking sends and receives; End() waits on them and stores the received
+// ghost values.  Between the two, owned entries may be used freely, allowing
+// work on owned-interior entities to be overlapped with the halo exchange:
+//
+//   scatter.Begin(*cv.ViewComponent("cell", false));
+//   ... work on entities touching only owned cells ...
+//   scatter.End(*cv.ViewComponent("cell", true));
+//   ... work on entities touching ghost cells ...
+//
+// Values are accessed through operator(), which is valid for owned entries at
+// any time and for ghost entries after End().  The source vector must not be
+// modified between Begin() and End().
+//
+// This assumes, as for all Amanzi meshes, that the ghosted map lists the
+// owned entries first, in the same order as the owned map.
+// -----------------------------------------------------------------------------
+
+#ifndef AMANZI_OPERATORS_SPLIT_PHASE_SCATTER_HH_
+#define AMANZI_OPERATORS_SPLIT_PHASE_SCATTER_HH_
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_Ptr.hpp"
+#include "Epetra_BlockMap.h"
+#include "Epetra_Import.h"
+#include "Epetra_MultiVector.h"
+
+namespace Amanzi {
+namespace Operators {
+
+class SplitPhaseScatter {
+
+ public:
+  SplitPhaseScatter(const Epetra_BlockMap& owned_map,
+                    const Epetra_BlockMap& ghosted_map);
+  ~SplitPhaseScatter();
+
+  SplitPhaseScatter(const SplitPhaseScatter& other) = delete;
+  SplitPhaseScatter& operator=(const SplitPhaseScatter& other) = delete;
+
+  // Post the exchange of the owned values of vec.  vec may be either the
+  // owned or the ghosted view of a component.
+  void Begin(const Epetra_MultiVector& vec);
+
+  // Complete the exchange.  If provided, the ghost entries of the ghosted
+  // vector are also filled.
+  void End(const Teuchos::Ptr<Epetra_MultiVector>& ghosted=Teuchos::null);
+
+  // Complete the exchange into the ghosted view of a CompositeVector
+  // component.  As for CompositeVector::ScatterMasterToGhosted(), ghost
+  // entries are refreshed even through a const vector.
+  void End(const Epetra_MultiVector& ghosted) {
+    End(Teuchos::ptr(const_cast<Epetra_MultiVector*>(&ghosted)));
+  }
+
+  bool IsOwned(int lid) const { return lid < nowned_; }
+
+  double operator()(int lid, int i=0) const {
+    return lid < nowned_ ? owned_[i][lid] : ghosts_[(lid - nowned_)*nvecs_ + i];
+  }
+
+ protected:
+  bool IsParallel_() const { return importer_ != Teuchos::null; }
+
+ protected:
+  int nowned_;
+  int nghost_;
+  int nvecs_;
+  double** owned_;
+  bool in_progress_;
+
+  Teuchos::RCP<Epetra_Import> importer_;
+
+  // work space, reused across calls
+  std::vector<double> exports_;
+  std::vector<double> ghosts_;
+  char* imports_;
+  int len_imports_;
+};
+
+} // namespace
+} // namespace
+
+#endif
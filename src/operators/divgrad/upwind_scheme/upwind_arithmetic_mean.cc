@@ -52,14 +52,18 @@ void UpwindArithmeticMean::CalculateCoefficientsOnFaces(
   // making the local matrices in MFD, so there is no need to
   // communicate the resulting face coeficients.
 
-  // communicate ghosted cells
-  cell_coef.ScatterMasterToGhosted("cell");
+  // communicate ghosted cells, overlapped with the owned cell sweep
+  if (cell_scatter_ == Teuchos::null) {
+    cell_scatter_ = Teuchos::rcp(new SplitPhaseScatter(*cell_coef.ComponentMap("cell", false),
+            *cell_coef.ComponentMap("cell", true)));
+  }
+  const Epetra_MultiVector& cell_coef_c = *cell_coef.ViewComponent("cell",false);
+  cell_scatter_->Begin(cell_coef_c);
 
   Epetra_MultiVector& face_coef_f = *face_coef->ViewComponent("face",true);
-  const Epetra_MultiVector& cell_coef_c = *cell_coef.ViewComponent("cell",true);
 
-  int c_used = cell_coef.size("cell", true);
-  for (int c=0; c!=c_used; ++c) {
+  int c_owned = cell_coef.size("cell", false);
+  for (int c=0; c!=c_owned; ++c) {
     mesh->cell_get_faces(c, &faces);
 
     for (unsigned int n=0; n!=faces.size(); ++n) {
@@ -68,6 +72,18 @@ void UpwindArithmeticMean::CalculateCoefficientsOnFaces(
     }
   }
 
+  cell_scatter_->End(*cell_coef.ViewComponent("cell",true));
+
+  int c_used = cell_coef.size("cell", true);
+  for (int c=c_owned; c!=c_used; ++c) {
+    mesh->cell_get_faces(c, &faces);
+
+    for (unsigned int n=0; n!=faces.size(); ++n) {
+      int f = faces[n];
+      face_coef_f[0][f] += (*cell_scatter_)(c) / 2.0;
+    }
+  }
+
   // rescale boundary faces, as these had only one cell neighbor
   unsigned int f_owned = mesh->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
   for (unsigned int f=0; f!=f_owned; ++f) {
@@ -15,6 +15,7 @@
 
 #include "Key.hh"
 #include "upwinding.hh"
+#include "SplitPhaseScatter.hh"
 
 namespace Amanzi {
 
@@ -57,6 +58,9 @@ private:
   Key pkname_;
   Key cell_coef_;
   Key face_coef_;
+
+  // split-phase ghost exchange of the cell coefficient
+  Teuchos::RCP<SplitPhaseScatter> cell_scatter_;
 };
 
 } // namespace
@@ -65,28 +65,36 @@ void UpwindGravityFlux::CalculateCoefficientsOnFaces(
   // making the local matrices in MFD, so there is no need to
   // communicate the resulting face coeficients.
 
-  // communicate ghosted cells
-  cell_coef.ScatterMasterToGhosted("cell");
+  // communicate ghosted cells, overlapped with the owned cell sweep
+  if (cell_scatter_ == Teuchos::null) {
+    cell_scatter_ = Teuchos::rcp(new SplitPhaseScatter(*cell_coef.ComponentMap("cell", false),
+            *cell_coef.ComponentMap("cell", true)));
+  }
+  cell_scatter_->Begin(*cell_coef.ViewComponent("cell",false));
 
   Epetra_MultiVector& face_coef_v = *face_coef->ViewComponent("face",true);
-  const Epetra_MultiVector& cell_coef_v = *cell_coef.ViewComponent("cell",true);
 
+  unsigned int c_owned = cell_coef.size("cell", false);
+  unsigned int c_used = cell_coef.size("cell", true);
+  for (unsigned int c=0; c!=c_used; ++c) {
+    if (c == c_owned) cell_scatter_->End(*cell_coef.ViewComponent("cell",true));
 
-  for (unsigned int c=0; c!=cell_coef.size("cell", true); ++c) {
     mesh->cell_get_faces_and_dirs(c, &faces, &dirs);
     AmanziGeometry::Point Kgravity = (*K_)[c] * gravity;
+    double coef = (*cell_scatter_)(c);
 
     for (unsigned int n=0; n!=faces.size(); ++n) {
       int f = faces[n];
 
       const AmanziGeometry::Point& normal = mesh->face_normal(f);
       if ((normal * Kgravity) * dirs[n] >= flow_eps) {
-        face_coef_v[0][f] = cell_coef_v[0][c];
+        face_coef_v[0][f] = coef;
       } else if (std::abs((normal * Kgravity) * dirs[n]) < flow_eps) {
-        face_coef_v[0][f] += cell_coef_v[0][c] / 2.;
+        face_coef_v[0][f] += coef / 2.;
       }
     }
   }
+  if (c_used == c_owned) cell_scatter_->End(*cell_coef.ViewComponent("cell",true));
 };
 
 
@@ -17,6 +17,7 @@
 #include "Tensor.hh"
 
 #include "upwinding.hh"
+#include "SplitPhaseScatter.hh"
 
 namespace Amanzi {
 
@@ -53,6 +54,9 @@ private:
   std::string face_coef_;
 
   Teuchos::RCP<std::vector<WhetStone::Tensor> > K_;
+
+  // split-phase ghost exchange of the cell coefficient
+  Teuchos::RCP<SplitPhaseScatter> cell_scatter_;
 };
 
 } // namespace
@@ -63,62 +63,89 @@ void UpwindPotentialDifference::CalculateCoefficientsOnFaces(
   std::vector<int> dirs;
   double eps = 1.e-16;
 
-  // communicate ghosted cells
-  cell_coef.ScatterMasterToGhosted("cell");
-  potential.ScatterMasterToGhosted("cell");
-  overlap.ScatterMasterToGhosted("cell");
+  // communicate ghosted cells, overlapped with faces whose cells are all owned
+  if (cell_scatter_ == Teuchos::null) {
+    const Epetra_BlockMap& cmap = *cell_coef.ComponentMap("cell", false);
+    const Epetra_BlockMap& cmap_wghost = *cell_coef.ComponentMap("cell", true);
+    cell_scatter_ = Teuchos::rcp(new SplitPhaseScatter(cmap, cmap_wghost));
+    potential_scatter_ = Teuchos::rcp(new SplitPhaseScatter(cmap, cmap_wghost));
+    overlap_scatter_ = Teuchos::rcp(new SplitPhaseScatter(cmap, cmap_wghost));
+  }
+  cell_scatter_->Begin(*cell_coef.ViewComponent("cell",false));
+  potential_scatter_->Begin(*potential.ViewComponent("cell",false));
+  overlap_scatter_->Begin(*overlap.ViewComponent("cell",false));
 
   Epetra_MultiVector& face_coef_f = *face_coef->ViewComponent("face",false);
-  const Epetra_MultiVector& overlap_c = *overlap.ViewComponent("cell",true);
-  const Epetra_MultiVector& potential_c = *potential.ViewComponent("cell",true);
+  const SplitPhaseScatter& overlap_c = *overlap_scatter_;
+  const SplitPhaseScatter& potential_c = *potential_scatter_;
   Teuchos::RCP<const Epetra_MultiVector> potential_f;
   if (potential.HasComponent("face")) potential_f = potential.ViewComponent("face",false);
-  const Epetra_MultiVector& cell_coef_c = *cell_coef.ViewComponent("cell",true);
+  const SplitPhaseScatter& cell_coef_c = *cell_scatter_;
 
   int nfaces = face_coef->size("face",false);
-  for (unsigned int f=0; f!=nfaces; ++f) {
-    mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+  ghosted_faces_.clear();
+  for (int pass=0; pass!=2; ++pass) {
+    if (pass == 1) {
+      cell_scatter_->End(*cell_coef.ViewComponent("cell",true));
+      potential_scatter_->End(*potential.ViewComponent("cell",true));
+      overlap_scatter_->End(*overlap.ViewComponent("cell",true));
+    }
 
-    if (cells.size() == 1) {
-      if (potential_f != Teuchos::null) {
-        if (potential_c[0][cells[0]] >= (*potential_f)[0][f]) {
-          face_coef_f[0][f] = cell_coef_c[0][cells[0]];
+    int nfaces_pass = pass == 0 ? nfaces : ghosted_faces_.size();
+    for (int n=0; n!=nfaces_pass; ++n) {
+      int f = pass == 0 ? n : ghosted_faces_[n];
+      mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+
+      // faces touching a ghost cell wait for the exchange
+      if (pass == 0) {
+        bool owned = true;
+        for (int i=0; i!=cells.size(); ++i) owned &= cell_scatter_->IsOwned(cells[i]);
+        if (!owned) {
+          ghosted_faces_.push_back(f);
+          continue;
         }
-      } else {
-        face_coef_f[0][f] = cell_coef_c[0][cells[0]];
-      }
-    } else {
-      // Determine the size of the overlap region, a smooth transition region
-      // near zero potential difference.
-      double ol0 = std::max(0., overlap_c[0][cells[0]]);
-      double ol1 = std::max(0., overlap_c[0][cells[1]]);
-
-      double flow_eps = 0.0;
-      if ((ol0 > 0) || (ol1 > 0)) {
-        flow_eps = (ol0 * ol1) / (ol0 + ol1);
       }
-      flow_eps = std::max(flow_eps, eps);
 
-      // Determine the coefficient.
-      if (potential_c[0][cells[0]] - potential_c[0][cells[1]] > flow_eps) {
-        face_coef_f[0][f] = cell_coef_c[0][cells[0]];
-      } else if (potential_c[0][cells[1]] - potential_c[0][cells[0]] > flow_eps) {
-        face_coef_f[0][f] = cell_coef_c[0][cells[1]];
+      if (cells.size() == 1) {
+        if (potential_f != Teuchos::null) {
+          if (potential_c(cells[0]) >= (*potential_f)[0][f]) {
+            face_coef_f[0][f] = cell_coef_c(cells[0]);
+          }
+        } else {
+          face_coef_f[0][f] = cell_coef_c(cells[0]);
+        }
       } else {
-        // Parameterization of a linear scaling between upwind and downwind.
-        double param;
-        if (flow_eps < 2*eps) {
-          param = 0.5;
+        // Determine the size of the overlap region, a smooth transition region
+        // near zero potential difference.
+        double ol0 = std::max(0., overlap_c(cells[0]));
+        double ol1 = std::max(0., overlap_c(cells[1]));
+
+        double flow_eps = 0.0;
+        if ((ol0 > 0) || (ol1 > 0)) {
+          flow_eps = (ol0 * ol1) / (ol0 + ol1);
+        }
+        flow_eps = std::max(flow_eps, eps);
+
+        // Determine the coefficient.
+        if (potential_c(cells[0]) - potential_c(cells[1]) > flow_eps) {
+          face_coef_f[0][f] = cell_coef_c(cells[0]);
+        } else if (potential_c(cells[1]) - potential_c(cells[0]) > flow_eps) {
+          face_coef_f[0][f] = cell_coef_c(cells[1]);
         } else {
-          param = (potential_c[0][cells[1]] - potential_c[0][cells[0]])
-              / (2*flow_eps) + 0.5;
+          // Parameterization of a linear scaling between upwind and downwind.
+          double param;
+          if (flow_eps < 2*eps) {
+            param = 0.5;
+          } else {
+            param = (potential_c(cells[1]) - potential_c(cells[0]))
+                / (2*flow_eps) + 0.5;
+          }
+          AMANZI_ASSERT(param >= 0.0);
+          AMANZI_ASSERT(param <= 1.0);
+          face_coef_f[0][f] = cell_coef_c(cells[1]) * param
+              + cell_coef_c(cells[0]) * (1. - param);
         }
-        AMANZI_ASSERT(param >= 0.0);
-        AMANZI_ASSERT(param <= 1.0);
-        face_coef_f[0][f] = cell_coef_c[0][cells[1]] * param
-            + cell_coef_c[0][cells[0]] * (1. - param);
       }
-
     }
   }
 };
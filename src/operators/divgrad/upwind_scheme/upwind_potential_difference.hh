@@ -14,6 +14,7 @@
 #define AMANZI_UPWINDING_POTENTIALDIFFERENCE_SCHEME_
 
 #include "upwinding.hh"
+#include "SplitPhaseScatter.hh"
 
 namespace Amanzi {
 
@@ -60,6 +61,12 @@ public:
   std::string face_coef_;
   std::string potential_;
   std::string overlap_;
+
+  // split-phase ghost exchange of the cell coefficient, potential and overlap
+  Teuchos::RCP<SplitPhaseScatter> cell_scatter_;
+  Teuchos::RCP<SplitPhaseScatter> potential_scatter_;
+  Teuchos::RCP<SplitPhaseScatter> overlap_scatter_;
+  std::vector<int> ghosted_faces_;
 };
 
 } // namespace
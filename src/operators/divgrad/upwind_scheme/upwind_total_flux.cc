@@ -55,13 +55,18 @@ void UpwindTotalFlux::CalculateCoefficientsOnFaces(
     face_coef->ViewComponent("cell",true)->PutScalar(1.0);
   }
 
-  // communicate needed ghost values
-  cell_coef.ScatterMasterToGhosted("cell");
+  // communicate needed ghost values, overlapped with identifying the
+  // upwind/downwind cells, which only needs the mesh and the local flux
+  if (cell_scatter_ == Teuchos::null) {
+    cell_scatter_ = Teuchos::rcp(new SplitPhaseScatter(*cell_coef.ComponentMap("cell", false),
+            *cell_coef.ComponentMap("cell", true)));
+  }
+  cell_scatter_->Begin(*cell_coef.ViewComponent("cell",false));
 
   // pull out vectors
   const Epetra_MultiVector& flux_v = *flux.ViewComponent("face",false);
   Epetra_MultiVector& coef_faces = *face_coef->ViewComponent("face",false);
-  const Epetra_MultiVector& coef_cells = *cell_coef.ViewComponent("cell",true);
+  const SplitPhaseScatter& coef_cells = *cell_scatter_;
 
   // Identify upwind/downwind cells for each local face.  Note upwind/downwind
   // may be a ghost cell.
@@ -81,10 +86,6 @@ void UpwindTotalFlux::CalculateCoefficientsOnFaces(
     for (unsigned int n=0; n!=faces.size(); ++n) {
       int f = faces[n];
 
-      if  (face_coef->HasComponent("cell")) {        
-        (*face_coef->ViewComponent("cell",true))[0][c] = coef_cells[0][c];
-      }
-
       if (f < nfaces_local) {
         if (flux_v[0][f] * fdirs[n] > 0) {
           upwind_cell[f] = c;
@@ -103,6 +104,13 @@ void UpwindTotalFlux::CalculateCoefficientsOnFaces(
     }
   }
 
+  cell_scatter_->End(*cell_coef.ViewComponent("cell",true));
+
+  if (face_coef->HasComponent("cell")) {
+    Epetra_MultiVector& coef_cells_out = *face_coef->ViewComponent("cell",true);
+    for (int c=0; c!=ncells; ++c) coef_cells_out[0][c] = coef_cells(c);
+  }
+
   // Determine the face coefficient of local faces.
   // These parameters may be key to a smooth convergence rate near zero flux.
   //  double flow_eps_factor = 1.;
@@ -127,14 +135,14 @@ void UpwindTotalFlux::CalculateCoefficientsOnFaces(
     if (uw == -1) {
       coefs[0] = coef_faces[0][f];
     } else {
-      coefs[0] = coef_cells[0][uw];
+      coefs[0] = coef_cells(uw);
     }
 
     // dw coef
     if (dw == -1) {
       coefs[1] = coef_faces[0][f];
     } else {
-      coefs[1] = coef_cells[0][dw];
+      coefs[1] = coef_cells(dw);
     }
 
     // Determine the size of the overlap region, a smooth transition region
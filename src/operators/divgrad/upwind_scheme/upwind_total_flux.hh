@@ -14,6 +14,7 @@
 #define AMANZI_UPWINDING_TOTALFLUX_SCHEME_
 
 #include "upwinding.hh"
+#include "SplitPhaseScatter.hh"
 
 namespace Amanzi {
 
@@ -60,6 +61,9 @@ private:
   std::string face_coef_;
   std::string flux_;
   double flux_eps_;
+
+  // split-phase ghost exchange of the cell coefficient
+  Teuchos::RCP<SplitPhaseScatter> cell_scatter_;
 };
 
 } // namespace
@@ -0,0 +1,292 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/* -------------------------------------------------------------------------
+ATS
+
+License: see $ATS_DIR/COPYRIGHT
+Author: Ethan Coon
+
+Backward Euler time integration using an inexact, Jacobian-free
+Newton-Krylov solver with Eisenstat-Walker forcing terms.
+------------------------------------------------------------------------- */
+
+#include <cmath>
+
+#include "bdf1_jfnk.hh"
+
+namespace Amanzi {
+
+BDF1_JFNK::BDF1_JFNK(BDFFnBase<TreeVector>& fn,
+                     Teuchos::ParameterList& plist,
+                     const Teuchos::RCP<TreeVector>& solution) :
+    fn_(fn),
+    plist_(plist),
+    u_(solution),
+    dt_prev_(-1.),
+    u_norm_(0.),
+    step_nonlinear_its_(0),
+    step_linear_its_(0),
+    total_nonlinear_its_(0),
+    total_linear_its_(0),
+    total_residuals_(0),
+    total_steps_(0),
+    total_failed_steps_(0)
+{
+  vo_ = Teuchos::rcp(new VerboseObject("BDF1_JFNK", plist_));
+
+  Teuchos::ParameterList& nk_list = plist_.sublist("inexact Newton-Krylov parameters");
+  tol_ = nk_list.get<double>("nonlinear tolerance", 1.e-6);
+  diverged_tol_ = nk_list.get<double>("diverged tolerance", 1.e10);
+  max_its_ = nk_list.get<int>("max nonlinear iterations", 15);
+  krylov_dim_ = nk_list.get<int>("max linear iterations", 20);
+  eta0_ = nk_list.get<double>("initial forcing term", 0.5);
+  eta_max_ = nk_list.get<double>("max forcing term", 0.9);
+  ew_gamma_ = nk_list.get<double>("forcing term gamma", 0.9);
+  ew_alpha_ = nk_list.get<double>("forcing term alpha", 2.0);
+  fd_eps_ = nk_list.get<double>("finite difference epsilon", 1.e-7);
+
+  Teuchos::ParameterList& dt_list = plist_.sublist("timestep controller standard parameters");
+  dt_max_its_ = dt_list.get<int>("max iterations", 10);
+  dt_min_its_ = dt_list.get<int>("min iterations", 5);
+  dt_increase_ = dt_list.get<double>("time step increase factor", 1.25);
+  dt_reduction_ = dt_list.get<double>("time step reduction factor", 0.5);
+  dt_max_ = dt_list.get<double>("max time step", 1.e10);
+  dt_min_ = dt_list.get<double>("min time step", 0.);
+
+  // work space
+  u_old_ = Teuchos::rcp(new TreeVector(*u_));
+  u_prev_ = Teuchos::rcp(new TreeVector(*u_));
+  res_ = Teuchos::rcp(new TreeVector(*u_));
+  du_ = Teuchos::rcp(new TreeVector(*u_));
+  u_save_ = Teuchos::rcp(new TreeVector(*u_));
+  z_ = Teuchos::rcp(new TreeVector(*u_));
+  krylov_.resize(krylov_dim_ + 1);
+  for (int i=0; i!=krylov_dim_+1; ++i) krylov_[i] = Teuchos::rcp(new TreeVector(*u_));
+  hessenberg_.shape(krylov_dim_ + 1, krylov_dim_);
+  givens_c_.resize(krylov_dim_);
+  givens_s_.resize(krylov_dim_);
+  g_.resize(krylov_dim_ + 1);
+}
+
+
+// -----------------------------------------------------------------------------
+// Take a backward Euler step.
+// -----------------------------------------------------------------------------
+bool BDF1_JFNK::TimeStep(double t_old, double dt, double& dt_next) {
+  Teuchos::OSTab tab = vo_->getOSTab();
+  double t_new = t_old + dt;
+  step_nonlinear_its_ = 0;
+  step_linear_its_ = 0;
+  total_steps_++;
+
+  // save the old solution
+  *u_old_ = *u_;
+
+  // predictor: extrapolate from history if possible
+  if (dt_prev_ > 0.) {
+    u_->Update(-dt/dt_prev_, *u_prev_, 1. + dt/dt_prev_);
+    if (!fn_.IsAdmissible(u_)) *u_ = *u_old_;
+  }
+  fn_.ModifyPredictor(dt, u_old_, u_);
+  fn_.ChangedSolution();
+
+  bool fail = true;
+  double res_norm_prev = -1.;
+  double eta = eta0_;
+  while (step_nonlinear_its_ < max_its_) {
+    // residual at the current iterate
+    fn_.FunctionalResidual(t_old, t_new, u_old_, u_, res_);
+    total_residuals_++;
+    double res_norm(0.);
+    res_->Norm2(&res_norm);
+    if (std::isnan(res_norm) || std::isinf(res_norm)) {
+      if (vo_->os_OK(Teuchos::VERB_MEDIUM))
+        *vo_->os() << "JFNK: residual is not finite." << std::endl;
+      break;
+    }
+
+    // forcing term
+    if (res_norm_prev > 0.) eta = ForcingTerm_(res_norm, res_norm_prev, eta);
+    res_norm_prev = res_norm;
+
+    // update the preconditioner and solve for the Newton correction
+    fn_.UpdatePreconditioner(t_new, u_, dt);
+    u_->Norm2(&u_norm_);
+    int lin_its = SolveLinear_(t_old, t_new, eta);
+    step_linear_its_ += lin_its;
+    step_nonlinear_its_++;
+
+    fn_.ModifyCorrection(dt, res_, u_, du_);
+
+    // update the solution
+    u_->Update(-1., *du_, 1.);
+    fn_.ChangedSolution();
+
+    double error = fn_.ErrorNorm(u_, du_);
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "JFNK: itr " << step_nonlinear_its_ << ", ||r|| = " << res_norm
+                 << ", eta = " << eta << ", linear itrs = " << lin_its
+                 << ", error = " << error << std::endl;
+
+    if (std::isnan(error) || error > diverged_tol_) {
+      if (vo_->os_OK(Teuchos::VERB_MEDIUM))
+        *vo_->os() << "JFNK: diverged, error = " << error << std::endl;
+      break;
+    }
+    if (error < tol_) {
+      fail = !fn_.IsAdmissible(u_);
+      if (fail && vo_->os_OK(Teuchos::VERB_MEDIUM))
+        *vo_->os() << "JFNK: converged to an inadmissible solution." << std::endl;
+      break;
+    }
+  }
+
+  total_nonlinear_its_ += step_nonlinear_its_;
+  total_linear_its_ += step_linear_its_;
+  if (fail) total_failed_steps_++;
+  ReportStatistics();
+
+  dt_next = NextTimestep_(dt, step_nonlinear_its_, fail);
+  return fail;
+}
+
+
+// -----------------------------------------------------------------------------
+// Save history for the predictor.
+// -----------------------------------------------------------------------------
+void BDF1_JFNK::CommitSolution(double dt) {
+  *u_prev_ = *u_old_;
+  dt_prev_ = dt;
+}
+
+
+// -----------------------------------------------------------------------------
+// Right-preconditioned GMRES on J du = r, with J applied by finite
+// differences.  The correction is left in du_.
+// -----------------------------------------------------------------------------
+int BDF1_JFNK::SolveLinear_(double t_old, double t_new, double eta) {
+  double beta(0.);
+  res_->Norm2(&beta);
+  du_->PutScalar(0.);
+  if (beta == 0.) return 0;
+
+  krylov_[0]->Update(1./beta, *res_, 0.);
+  std::fill(g_.begin(), g_.end(), 0.);
+  g_[0] = beta;
+
+  int k = 0;
+  while (k < krylov_dim_) {
+    // w = J P^-1 v_k, stored in v_k+1
+    fn_.ApplyPreconditioner(krylov_[k], z_);
+    ApplyJacobian_(t_old, t_new, *z_, *krylov_[k+1]);
+
+    // modified Gram-Schmidt
+    for (int i=0; i<=k; ++i) {
+      double h(0.);
+      krylov_[k+1]->Dot(*krylov_[i], &h);
+      hessenberg_(i,k) = h;
+      krylov_[k+1]->Update(-h, *krylov_[i], 1.);
+    }
+    double h_next(0.);
+    krylov_[k+1]->Norm2(&h_next);
+    hessenberg_(k+1,k) = h_next;
+    if (h_next > 0.) krylov_[k+1]->Scale(1./h_next);
+
+    // apply previous rotations, then form and apply the new one
+    for (int i=0; i<k; ++i) {
+      double tmp = givens_c_[i] * hessenberg_(i,k) + givens_s_[i] * hessenberg_(i+1,k);
+      hessenberg_(i+1,k) = -givens_s_[i] * hessenberg_(i,k) + givens_c_[i] * hessenberg_(i+1,k);
+      hessenberg_(i,k) = tmp;
+    }
+    double denom = std::sqrt(hessenberg_(k,k)*hessenberg_(k,k) + h_next*h_next);
+    givens_c_[k] = denom > 0. ? hessenberg_(k,k) / denom : 1.;
+    givens_s_[k] = denom > 0. ? h_next / denom : 0.;
+    hessenberg_(k,k) = denom;
+    hessenberg_(k+1,k) = 0.;
+    g_[k+1] = -givens_s_[k] * g_[k];
+    g_[k] = givens_c_[k] * g_[k];
+    k++;
+
+    if (std::abs(g_[k]) <= eta * beta || h_next == 0.) break;
+  }
+
+  // back substitution for the Krylov coefficients
+  std::vector<double> y(k, 0.);
+  for (int i=k-1; i>=0; --i) {
+    double tmp = g_[i];
+    for (int j=i+1; j<k; ++j) tmp -= hessenberg_(i,j) * y[j];
+    y[i] = hessenberg_(i,i) != 0. ? tmp / hessenberg_(i,i) : 0.;
+  }
+
+  // du = P^-1 V y
+  z_->PutScalar(0.);
+  for (int i=0; i!=k; ++i) z_->Update(y[i], *krylov_[i], 1.);
+  fn_.ApplyPreconditioner(z_, du_);
+  return k;
+}
+
+
+// -----------------------------------------------------------------------------
+// Jv = (F(u + eps v) - F(u)) / eps, where F(u) is in res_.
+// -----------------------------------------------------------------------------
+void BDF1_JFNK::ApplyJacobian_(double t_old, double t_new,
+        const TreeVector& v, TreeVector& Jv) {
+  double v_norm(0.);
+  v.Norm2(&v_norm);
+  if (v_norm == 0.) {
+    Jv.PutScalar(0.);
+    return;
+  }
+  double eps = fd_eps_ * (1. + u_norm_) / v_norm;
+
+  // The PKs evaluate the residual from State, which aliases u_, so perturb u_
+  // in place and restore it afterwards.
+  *u_save_ = *u_;
+  u_->Update(eps, v, 1.);
+  fn_.ChangedSolution();
+  fn_.FunctionalResidual(t_old, t_new, u_old_, u_, Teuchos::rcpFromRef(Jv));
+  total_residuals_++;
+  *u_ = *u_save_;
+  fn_.ChangedSolution();
+
+  Jv.Update(-1./eps, *res_, 1./eps);
+}
+
+
+double BDF1_JFNK::ForcingTerm_(double res_norm, double res_norm_prev, double eta_prev) const {
+  double eta = ew_gamma_ * std::pow(res_norm / res_norm_prev, ew_alpha_);
+
+  // safeguard against the forcing term decreasing too quickly
+  double eta_safe = ew_gamma_ * std::pow(eta_prev, ew_alpha_);
+  if (eta_safe > 0.1) eta = std::max(eta, eta_safe);
+  return std::min(eta, eta_max_);
+}
+
+
+double BDF1_JFNK::NextTimestep_(double dt, int nonlinear_its, bool fail) const {
+  double dt_next = dt;
+  if (fail) {
+    dt_next = dt * dt_reduction_;
+  } else if (nonlinear_its < dt_min_its_) {
+    dt_next = dt * dt_increase_;
+  } else if (nonlinear_its > dt_max_its_) {
+    dt_next = dt * dt_reduction_;
+  }
+  return std::max(std::min(dt_next, dt_max_), dt_min_);
+}
+
+
+void BDF1_JFNK::ReportStatistics() const {
+  if (vo_->os_OK(Teuchos::VERB_LOW)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "JFNK step: nonlinear itrs = " << step_nonlinear_its_
+               << ", linear itrs = " << step_linear_its_ << std::endl
+               << "JFNK totals: steps = " << total_steps_
+               << " (failed = " << total_failed_steps_ << ")"
+               << ", nonlinear itrs = " << total_nonlinear_its_
+               << ", linear itrs = " << total_linear_its_
+               << ", residual evaluations = " << total_residuals_ << std::endl;
+  }
+}
+
+} // namespace
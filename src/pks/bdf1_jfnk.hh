@@ -0,0 +1,154 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! Backward Euler time integration using a Jacobian-free Newton-Krylov solver.
+
+/*
+  ATS is released under the three-clause BSD License. 
+  The terms of use and "as is" disclaimer for this license are 
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+
+/*!
+
+``BDF1_JFNK`` advances a ``BDFFnBase`` by a backward Euler step, solving the
+nonlinear system with an inexact Newton method.  Each Newton correction is
+found by right-preconditioned GMRES on the true Jacobian, whose action is
+approximated by finite differences of ``FunctionalResidual``:
+
+:math:`J v \approx ( F(u + \epsilon v) - F(u) ) / \epsilon`
+
+The PK's ``ApplyPreconditioner`` is used as the right preconditioner.  The
+linear solve is only converged to a relative tolerance :math:`\eta_k`, chosen
+by the Eisenstat-Walker (choice 2) forcing term, so that early Newton
+iterations are cheap and later ones converge superlinearly.
+
+This is used by ``PKBDFBase`` when the `"time integrator`" sublist sets
+`"time integration method`" to `"BDF1 JFNK`".  Parameters are read from the
+`"inexact Newton-Krylov parameters`" sublist of the time integrator:
+
+* `"nonlinear tolerance`" ``[double]`` **1.e-6** Converged when the PK's
+  ``ErrorNorm`` of the correction is below this value.
+
+* `"diverged tolerance`" ``[double]`` **1.e10** Fail the step when the
+  ``ErrorNorm`` of the correction exceeds this value.
+
+* `"max nonlinear iterations`" ``[int]`` **15**
+
+* `"max linear iterations`" ``[int]`` **20** Maximum Krylov dimension of each
+  (unrestarted) GMRES solve.
+
+* `"initial forcing term`" ``[double]`` **0.5**
+
+* `"max forcing term`" ``[double]`` **0.9**
+
+* `"forcing term gamma`" ``[double]`` **0.9**
+
+* `"forcing term alpha`" ``[double]`` **2.0**
+
+* `"finite difference epsilon`" ``[double]`` **1.e-7** Relative size of the
+  perturbation used in Jacobian-vector products.
+
+Timestep control uses the `"timestep controller standard parameters`"
+sublist of the time integrator, as for ``BDF1``, with the nonlinear iteration
+count of the step.
+
+*/
+
+#ifndef ATS_BDF1_JFNK_HH_
+#define ATS_BDF1_JFNK_HH_
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_SerialDenseMatrix.hpp"
+
+#include "VerboseObject.hh"
+#include "TreeVector.hh"
+#include "BDFFnBase.hh"
+
+namespace Amanzi {
+
+class BDF1_JFNK {
+
+ public:
+  BDF1_JFNK(BDFFnBase<TreeVector>& fn,
+            Teuchos::ParameterList& plist,
+            const Teuchos::RCP<TreeVector>& solution);
+
+  // Advance the solution from t_old by dt.  Returns true on failure.  dt_next
+  // is the recommended size of the next step (or of the retry, on failure).
+  bool TimeStep(double t_old, double dt, double& dt_next);
+
+  // Save the accepted step as history for the next predictor.
+  void CommitSolution(double dt);
+
+  // Forget the history, e.g. after a step that was rejected as invalid, so
+  // that the next predictor does not extrapolate from it.
+  void ResetHistory() { dt_prev_ = -1.; }
+
+  // statistics
+  int number_nonlinear_steps() const { return step_nonlinear_its_; }
+  int number_linear_steps() const { return step_linear_its_; }
+  void ReportStatistics() const;
+
+ protected:
+  // Solve J du = r to a relative tolerance eta, returning the number of
+  // Krylov iterations.
+  int SolveLinear_(double t_old, double t_new, double eta);
+
+  // Finite difference approximation of Jv = J(u) * v.
+  void ApplyJacobian_(double t_old, double t_new,
+                      const TreeVector& v, TreeVector& Jv);
+
+  // Eisenstat-Walker choice 2.
+  double ForcingTerm_(double res_norm, double res_norm_prev, double eta_prev) const;
+
+  double NextTimestep_(double dt, int nonlinear_its, bool fail) const;
+
+ protected:
+  BDFFnBase<TreeVector>& fn_;
+  Teuchos::ParameterList plist_;
+  Teuchos::RCP<VerboseObject> vo_;
+
+  // nonlinear parameters
+  double tol_;
+  double diverged_tol_;
+  int max_its_;
+  double fd_eps_;
+
+  // forcing term parameters
+  int krylov_dim_;
+  double eta0_, eta_max_, ew_gamma_, ew_alpha_;
+
+  // timestep controller parameters
+  int dt_max_its_, dt_min_its_;
+  double dt_increase_, dt_reduction_, dt_max_, dt_min_;
+
+  // solution and history
+  Teuchos::RCP<TreeVector> u_;
+  Teuchos::RCP<TreeVector> u_old_;
+  Teuchos::RCP<TreeVector> u_prev_;
+  double dt_prev_;
+  double u_norm_;
+
+  // work space
+  Teuchos::RCP<TreeVector> res_;
+  Teuchos::RCP<TreeVector> du_;
+  Teuchos::RCP<TreeVector> u_save_;
+  Teuchos::RCP<TreeVector> z_;
+  std::vector<Teuchos::RCP<TreeVector> > krylov_;
+  Teuchos::SerialDenseMatrix<int, double> hessenberg_;
+  std::vector<double> givens_c_, givens_s_, g_;
+
+  // statistics
+  int step_nonlinear_its_, step_linear_its_;
+  int total_nonlinear_its_, total_linear_its_, total_residuals_;
+  int total_steps_, total_failed_steps_;
+};
+
+} // namespace
+
+#endif
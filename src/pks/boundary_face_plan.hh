@@ -0,0 +1,166 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! BoundaryFacePlan: boundary topology used in updating boundary conditions.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*!
+
+PKs rebuild their boundary condition markers and values on every residual
+and preconditioner update.  Doing so from the mesh means a face_get_cells()
+call per owned face, to find the boundary faces left to a zero flux default,
+and an entity_get_parent() call per surface cell for the coupling
+conditions.  Neither depends on anything but the mesh topology, so both are
+computed here once per mesh and shared by all PKs on it, leaving only the
+values to be refreshed on each update.
+
+The same holds for evaluators coupling a surface to this mesh, which use the
+map from each surface cell to its parent face and that face's top cell.
+
+Topology is unchanged by deformation, so a plan is never invalidated.  Plans
+and their surface maps hold their meshes weakly, and are rebuilt, rather than
+reused, if a mesh was freed and another allocated at the same address.
+
+*/
+
+#ifndef ATS_BOUNDARY_FACE_PLAN_HH_
+#define ATS_BOUNDARY_FACE_PLAN_HH_
+
+#include <algorithm>
+#include <map>
+#include <memory>
+
+#include "Teuchos_RCP.hpp"
+
+#include "dbc.hh"
+#include "Mesh.hh"
+#include "OperatorDefs.hh"
+
+namespace Amanzi {
+
+class BoundaryFacePlan {
+
+ public:
+  static const BoundaryFacePlan& Get(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
+  {
+    auto& plans = Plans_();
+    auto& plan = plans[mesh.get()];
+    if (!plan || !plan->mesh_.shares_resource(mesh)) plan.reset(new BoundaryFacePlan(mesh));
+    return *plan;
+  }
+
+  // Owned faces with exactly one cell.
+  const AmanziMesh::Entity_ID_List& boundary_faces() const { return faces_; }
+
+  // Is an owned face on the boundary?
+  bool IsBoundary(AmanziMesh::Entity_ID f) const { return cell_of_face_[f] >= 0; }
+
+  // The cell of a boundary face.
+  AmanziMesh::Entity_ID BoundaryCell(AmanziMesh::Entity_ID f) const
+  {
+    if (f < (int) cell_of_face_.size() && cell_of_face_[f] >= 0) return cell_of_face_[f];
+    AmanziMesh::Entity_ID_List cells;
+    mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+    return cells[0];
+  }
+
+  // For each owned cell of a surface of this mesh, the parent face, its one
+  // (top) cell, and the orientation of the face's normal relative to the
+  // outward normal of that cell.
+  struct SurfaceMap {
+    AmanziMesh::Entity_ID_List faces;
+    AmanziMesh::Entity_ID_List cells;
+    std::vector<int> dirs;
+    Teuchos::RCP<const AmanziMesh::Mesh> surface;  // weak
+  };
+
+  const SurfaceMap& Surface(const Teuchos::RCP<const AmanziMesh::Mesh>& surface) const
+  {
+    auto entry = surfaces_.find(surface.get());
+    if (entry != surfaces_.end() && !entry->second.surface.shares_resource(surface)) {
+      surfaces_.erase(entry);
+      entry = surfaces_.end();
+    }
+    if (entry == surfaces_.end()) {
+      entry = surfaces_.emplace(surface.get(), SurfaceMap()).first;
+      SurfaceMap& map = entry->second;
+      map.surface = surface.create_weak();
+      int ncells = surface->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+      map.faces.resize(ncells);
+      map.cells.resize(ncells);
+      map.dirs.resize(ncells);
+
+      AmanziMesh::Entity_ID_List faces;
+      std::vector<int> dirs;
+      for (int c=0; c!=ncells; ++c) {
+        AmanziMesh::Entity_ID f = surface->entity_get_parent(AmanziMesh::CELL, c);
+        map.faces[c] = f;
+        map.cells[c] = BoundaryCell(f);
+        mesh_->cell_get_faces_and_dirs(map.cells[c], &faces, &dirs);
+        int i = std::find(faces.begin(), faces.end(), f) - faces.begin();
+        AMANZI_ASSERT(i < (int) faces.size());
+        map.dirs[c] = dirs[i];
+      }
+    }
+    return entry->second;
+  }
+
+  // The face of this mesh that is the parent of each owned cell of surface.
+  const AmanziMesh::Entity_ID_List& SurfaceFaces(const Teuchos::RCP<const AmanziMesh::Mesh>& surface) const
+  {
+    return Surface(surface).faces;
+  }
+
+  // Mark boundary faces which are still OPERATOR_BC_NONE with a zero flux
+  // condition, returning how many were marked.
+  int MarkDefault(std::vector<int>& markers, std::vector<double>& values) const
+  {
+    int n_default = 0;
+    for (auto f : faces_) {
+      if (markers[f] == Operators::OPERATOR_BC_NONE) {
+        markers[f] = Operators::OPERATOR_BC_NEUMANN;
+        values[f] = 0.0;
+        n_default++;
+      }
+    }
+    return n_default;
+  }
+
+ private:
+  explicit BoundaryFacePlan(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh) :
+      mesh_(mesh.create_weak())
+  {
+    int nfaces_owned = mesh->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
+    cell_of_face_.resize(nfaces_owned, -1);
+
+    AmanziMesh::Entity_ID_List cells;
+    for (int f=0; f!=nfaces_owned; ++f) {
+      mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+      if (cells.size() == 1) {
+        faces_.push_back(f);
+        cell_of_face_[f] = cells[0];
+      }
+    }
+  }
+
+  static std::map<const AmanziMesh::Mesh*, std::unique_ptr<BoundaryFacePlan> >& Plans_()
+  {
+    static std::map<const AmanziMesh::Mesh*, std::unique_ptr<BoundaryFacePlan> > plans;
+    return plans;
+  }
+
+ private:
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh_;  // weak
+  AmanziMesh::Entity_ID_List faces_;
+  std::vector<AmanziMesh::Entity_ID> cell_of_face_;
+  mutable std::map<const AmanziMesh::Mesh*, SurfaceMap> surfaces_;
+};
+
+} // namespace Amanzi
+
+#endif
@@ -1,3 +1,4 @@
+#include "region_entity_cache.hh"
 #include "deform.hh"
 
 namespace Amanzi {
@@ -437,7 +438,7 @@ void DeformMesh::bell_shaped_profile( double ss ) {
   bool keep_valid = true;
 
   // compute the deformed mesh
-  mesh0_->deform( nodeids, newpos, keep_valid, &finpos);
+  Amanzi::DeformMeshAndCaches(*mesh0_, nodeids, newpos, keep_valid, &finpos);
 }
 
 // move the nodes following a layer profile
@@ -504,7 +505,7 @@ void DeformMesh::layer_profile( double ss ) {
   bool keep_valid = true;
 
   // compute the deformed mesh
-  mesh0_->deform( nodeids, newpos, keep_valid, &finpos);
+  Amanzi::DeformMeshAndCaches(*mesh0_, nodeids, newpos, keep_valid, &finpos);
 }
 
 void DeformMesh::bell_shaped_profile( double ss,
@@ -588,7 +589,7 @@ void DeformMesh::bell_shaped_profile( double ss,
 
   // compute the deformed mesh
   cout << "--->call deform" << endl ;
-  mesh0_->deform( nodeids, newpos, keep_valid, &finpos);
+  Amanzi::DeformMeshAndCaches(*mesh0_, nodeids, newpos, keep_valid, &finpos);
 }
 
 // driver routine (to be called by main in UnitTest)
@@ -767,7 +768,7 @@ void DeformMesh::build_the_starting_mesh( Entity_ID_List & newnod ) {
 
   // compute the deformed mesh
   cout << "--->call deform" << endl ;
-  mesh0_->deform( newnod, newpos, keep_valid, &finpos);
+  Amanzi::DeformMeshAndCaches(*mesh0_, newnod, newpos, keep_valid, &finpos);
 }
 
 void DeformMesh::mesh_deformation() {
@@ -838,7 +839,7 @@ void DeformMesh::mesh_deformation() {
     // compute the deformed mesh
     cout << endl;
     cout << "--->call deform" << endl ;
-    mesh_->deform( nodids, newpos, keep_valid, &finpos);
+    Amanzi::DeformMeshAndCaches(*mesh_, nodids, newpos, keep_valid, &finpos);
 
     // VTK output
     string fname("");
@@ -906,7 +907,7 @@ void DeformMesh::mesh_deformation_top_nodes() {
 
     // compute the deformed mesh
     cout << "--->call deform" << endl ;
-    mesh_->deform( nodeids, newpos, keep_valid, &finpos);
+    Amanzi::DeformMeshAndCaches(*mesh_, nodeids, newpos, keep_valid, &finpos);
 
     // VTK output
     string fname("");
@@ -1088,7 +1089,7 @@ void DeformMesh::analyze_final_Mesh() {
   bool check_mesh_deformation = false;
   if ( check_mesh_deformation ) {
     cout << "--->call deform" << endl ;
-    mesh0_->deform( newnod, newpos, keep_valid, &finpos);
+    Amanzi::DeformMeshAndCaches(*mesh0_, newnod, newpos, keep_valid, &finpos);
   }
 }
 
@@ -16,6 +16,7 @@
 
 #include "prescribed_deformation.hh"
 #include "porosity_evaluator.hh"
+#include "region_entity_cache.hh"
 
 namespace Amanzi {
 namespace Deform {
@@ -269,7 +270,7 @@ bool PrescribedDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
       ->ViewComponent("cell",false);
 
   // deform the mesh
-  write_access_mesh_->deform( nodeids, newpos, true, &finpos); // deforms the mesh itself
+  Amanzi::DeformMeshAndCaches(*write_access_mesh_, nodeids, newpos, true, &finpos); // deforms the mesh itself
 
 
   // now we have to adapt the surface mesh to the new volume mesh
@@ -298,8 +299,8 @@ bool PrescribedDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
   }
   // now deform the surface meshes, note that we set the keep_valid flag to false, since
   // we want the surface mesh to exactly mirror the domain mesh
-  write_access_surface_mesh_->deform( surface_nodeids, surface_newpos, false, &surface_finpos);
-  write_access_surface3d_mesh_->deform( surface3d_nodeids, surface3d_newpos, false, &surface_finpos);
+  Amanzi::DeformMeshAndCaches(*write_access_surface_mesh_, surface_nodeids, surface_newpos, false, &surface_finpos);
+  Amanzi::DeformMeshAndCaches(*write_access_surface3d_mesh_, surface3d_nodeids, surface3d_newpos, false, &surface_finpos);
 
 
 
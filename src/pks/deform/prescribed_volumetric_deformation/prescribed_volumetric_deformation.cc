@@ -16,6 +16,7 @@
 
 #include "prescribed_volumetric_deformation.hh"
 #include "porosity_evaluator.hh"
+#include "region_entity_cache.hh"
 
 namespace Amanzi {
 namespace Deform {
@@ -187,18 +188,15 @@ bool PrescribedVolumetricDeformation::advance(double dt) {
     fac = fT1 / fT0;
   }
 
-  unsigned int mesh_block_size = write_access_mesh_->get_set_size(deform_region_,
-                                                                  Amanzi::AmanziMesh::CELL,
-                                                                  Amanzi::AmanziMesh::Parallel_type::OWNED);
-  Amanzi::AmanziMesh::Entity_ID_List cell_ids(mesh_block_size);
-  write_access_mesh_->get_set_entities(deform_region_, Amanzi::AmanziMesh::CELL, Amanzi::AmanziMesh::Parallel_type::OWNED,
-                                       &cell_ids);
-  for( Amanzi::AmanziMesh::Entity_ID_List::iterator c = cell_ids.begin(); c != cell_ids.end();  c++) {
+  const Amanzi::AmanziMesh::Entity_ID_List& cell_ids =
+      Amanzi::RegionEntityCache::Get(S_next_->GetMesh(), deform_region_, Amanzi::AmanziMesh::CELL,
+                                     Amanzi::AmanziMesh::Parallel_type::OWNED);
+  for( Amanzi::AmanziMesh::Entity_ID_List::const_iterator c = cell_ids.begin(); c != cell_ids.end();  c++) {
     target_cell_volumes[*c] = fac * cv[0][*c];
   }
   
   // deform the mesh
-  write_access_mesh_->deform( target_cell_volumes, min_cell_volumes, bottom_surface_, true); // deforms the mesh itself
+  Amanzi::DeformMeshAndCaches(*write_access_mesh_, target_cell_volumes, min_cell_volumes, bottom_surface_, true); // deforms the mesh itself
 
   // for( Amanzi::AmanziMesh::Entity_ID_List::iterator c = cell_ids.begin(); c != cell_ids.end();  c++) {
   //   std::cout << min_cell_volumes[*c] << " " << target_cell_volumes[*c] << " " << cv[0][*c] << " " << write_access_mesh_->cell_volume(*c) <<std::endl;
@@ -231,8 +229,8 @@ bool PrescribedVolumetricDeformation::advance(double dt) {
   }
   // now deform the surface meshes, note that we set the keep_valid flag to false, since
   // we want the surface mesh to exactly mirror the domain mesh
-  write_access_surface_mesh_->deform( surface_nodeids, surface_newpos, false, &surface_finpos);
-  write_access_surface3d_mesh_->deform( surface3d_nodeids, surface3d_newpos, false, &surface_finpos);
+  Amanzi::DeformMeshAndCaches(*write_access_surface_mesh_, surface_nodeids, surface_newpos, false, &surface_finpos);
+  Amanzi::DeformMeshAndCaches(*write_access_surface3d_mesh_, surface3d_nodeids, surface3d_newpos, false, &surface_finpos);
 
 
 
@@ -21,6 +21,7 @@
 
 #include "LinearOperatorFactory.hh"
 #include "CompositeVectorFunctionFactory.hh"
+#include "region_entity_cache.hh"
 
 #include "volumetric_deformation.hh"
 
@@ -347,9 +348,9 @@ bool VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
       double min_porosity =  plist_->get<double>("minimum porosity", 0.5);
       double scl = plist_->get<double>("deformation scaling", 1.);
 
-      AmanziMesh::Entity_ID_List cells;
-      mesh_->get_set_entities(deform_region_, AmanziMesh::CELL,
-              AmanziMesh::Parallel_type::OWNED, &cells);
+      const AmanziMesh::Entity_ID_List& cells =
+          RegionEntityCache::Get(mesh_, deform_region_, AmanziMesh::CELL,
+                                 AmanziMesh::Parallel_type::OWNED);
       
       for (AmanziMesh::Entity_ID_List::const_iterator c=cells.begin(); c!=cells.end(); ++c) {
         double frac = 0.;
@@ -403,8 +404,9 @@ bool VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
       dcell_vol_c.PutScalar(0.);
       int dim = mesh_->space_dimension();
 
-      AmanziMesh::Entity_ID_List cells;
-      mesh_->get_set_entities(deform_region_, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &cells);
+      const AmanziMesh::Entity_ID_List& cells =
+          RegionEntityCache::Get(mesh_, deform_region_, AmanziMesh::CELL,
+                                 AmanziMesh::Parallel_type::OWNED);
 
       double time_factor = dt > time_scale_ ? 1 : dt / time_scale_;
       for (AmanziMesh::Entity_ID_List::const_iterator c=cells.begin(); c!=cells.end(); ++c) {
@@ -442,9 +444,9 @@ bool VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
       strategy_ == DEFORM_STRATEGY_MSTK) {
     // set up the fixed list
     fixed_node_list = Teuchos::rcp(new AmanziMesh::Entity_ID_List());
-    AmanziMesh::Entity_ID_List nodes;
-    mesh_->get_set_entities("bottom face", AmanziMesh::NODE,
-                            AmanziMesh::Parallel_type::OWNED, &nodes);
+    const AmanziMesh::Entity_ID_List& nodes =
+        RegionEntityCache::Get(mesh_, "bottom face", AmanziMesh::NODE,
+                               AmanziMesh::Parallel_type::OWNED);
     for (AmanziMesh::Entity_ID_List::const_iterator n=nodes.begin();
          n!=nodes.end(); ++n) {                  
       fixed_node_list->push_back(*n);
@@ -525,7 +527,7 @@ bool VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
       std::cout << std::endl;
 #endif
       
-      mesh_nc_->deform(target_cell_vols, min_cell_vols, *below_node_list, true);
+      DeformMeshAndCaches(*mesh_nc_, target_cell_vols, min_cell_vols, *below_node_list, true);
       solution_evaluator_->SetFieldAsChanged(S_next_.ptr());
       
 
@@ -635,7 +637,7 @@ bool VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
       // DEBUG CRUFT END
 #endif
       
-      mesh_nc_->deform(node_ids, new_positions, true, &final_positions);
+      DeformMeshAndCaches(*mesh_nc_, node_ids, new_positions, true, &final_positions);
 
       // INSERT EXTRA CODE TO UNDEFORM THE MESH FOR MIN_VOLS!
 
@@ -702,8 +704,8 @@ bool VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
       surface_newpos.push_back(coord_surface);
     }
     AmanziGeometry::Point_List surface_finpos;
-    surf_mesh_nc_->deform(surface_nodeids, surface_newpos, false, &surface_finpos);
-    surf3d_mesh_nc_->deform(surface3d_nodeids, surface3d_newpos, false, &surface_finpos);
+    DeformMeshAndCaches(*surf_mesh_nc_, surface_nodeids, surface_newpos, false, &surface_finpos);
+    DeformMeshAndCaches(*surf3d_mesh_nc_, surface3d_nodeids, surface3d_newpos, false, &surface_finpos);
   }
 
   {  // update vertex coordinates in state (for checkpointing and error recovery)
@@ -127,6 +127,13 @@ public:
   virtual void ApplyDiffusion_(const Teuchos::Ptr<State>& S,
           const Teuchos::Ptr<CompositeVector>& f);
 
+  // -- diffusion and advection together, computed directly from the
+  //    coefficients without assembling matrix_diff_ or matrix_adv_
+  virtual void ApplyDiffusionAndAdvection_(const Teuchos::Ptr<State>& S,
+          const Teuchos::Ptr<State>& S_adv,
+          const Teuchos::Ptr<CompositeVector>& f);
+  void UpdateTransmissibility_();
+
   virtual double BoundaryFaceValue(int f, const CompositeVector& u);
   virtual int BoundaryFaceGetCell(int f) const;
 
@@ -170,6 +177,12 @@ public:
   bool jacobian_;
 
   bool compute_boundary_values_;
+
+  // matrix-free residual: transmissibility of each face, i.e. the two-point
+  // flux operator with unit conductivity, recomputed on a dynamic mesh
+  bool matrix_free_residual_;
+  bool dynamic_mesh_;
+  Teuchos::RCP<CompositeVector> trans_;
   
   double T_limit_;
   double mass_atol_;
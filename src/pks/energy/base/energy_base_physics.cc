@@ -104,6 +104,125 @@ void EnergyBase::ApplyDiffusion_(const Teuchos::Ptr<State>& S,
 };
 
 
+// -------------------------------------------------------------
+// Diffusion and advection terms without assembly.
+//
+// The residual is evaluated far more often than the preconditioner is
+// updated (line searches, error checks), and assembling the local matrices
+// of both operators just to apply them dominates its cost.  With a two-point
+// flux, each face's diffusive flux is its transmissibility times the
+// upwinded conductivity times the temperature difference, and the advected
+// enthalpy is upwinded by the sign of the mass flux, so both are summed
+// directly into each cell.  This is the same discretization, including
+// boundary conditions, as ApplyDiffusion_() and AddAdvection_().
+// -------------------------------------------------------------
+void EnergyBase::ApplyDiffusionAndAdvection_(const Teuchos::Ptr<State>& S,
+        const Teuchos::Ptr<State>& S_adv,
+        const Teuchos::Ptr<CompositeVector>& g) {
+  if (trans_ == Teuchos::null || dynamic_mesh_) UpdateTransmissibility_();
+
+  // update the thermal conductivity
+  UpdateConductivityData_(S_next_.ptr());
+  Teuchos::RCP<const CompositeVector> conductivity =
+      S_next_->GetFieldData(uw_conductivity_key_);
+  Teuchos::RCP<const CompositeVector> temp = S->GetFieldData(key_);
+  conductivity->ScatterMasterToGhosted("face");
+  temp->ScatterMasterToGhosted("cell");
+
+  // enthalpy and the mass flux advecting it
+  Teuchos::RCP<const CompositeVector> flux = S_adv->GetFieldData(flux_key_);
+  db_->WriteVector(" adv flux", flux.ptr(), true);
+  S_adv->GetFieldEvaluator(enthalpy_key_)->HasFieldChanged(S_adv, name_);
+  Teuchos::RCP<const CompositeVector> enth = S_adv->GetFieldData(enthalpy_key_);
+  ApplyDirichletBCsToEnthalpy_(S_adv);
+  flux->ScatterMasterToGhosted("face");
+  enth->ScatterMasterToGhosted("cell");
+
+  const Epetra_MultiVector& trans_f = *trans_->ViewComponent("face", true);
+  const Epetra_MultiVector& cond_f = *conductivity->ViewComponent("face", true);
+  const Epetra_MultiVector& temp_c = *temp->ViewComponent("cell", true);
+  const Epetra_MultiVector& flux_f = *flux->ViewComponent("face", true);
+  const Epetra_MultiVector& enth_c = *enth->ViewComponent("cell", true);
+  Epetra_MultiVector& eflux_f = *S->GetFieldData(energy_flux_key_, name_)
+      ->ViewComponent("face", false);
+  int nfaces_owned = eflux_f.MyLength();
+
+  const auto& markers = bc_markers();
+  const auto& values = bc_values();
+  const auto& adv_markers = bc_adv_->bc_model();
+  const auto& adv_values = bc_adv_->bc_value();
+
+  g->PutScalar(0.);
+  Epetra_MultiVector& g_c = *g->ViewComponent("cell", false);
+
+  AmanziMesh::Entity_ID_List faces, cells;
+  std::vector<int> dirs;
+  int ncells = g_c.MyLength();
+  for (int c=0; c!=ncells; ++c) {
+    mesh_->cell_get_faces_and_dirs(c, &faces, &dirs);
+    for (int n=0; n!=faces.size(); ++n) {
+      int f = faces[n];
+      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+      int c_nbr = cells.size() == 1 ? -1 : (cells[0] == c ? cells[1] : cells[0]);
+
+      // diffusive flux out of c
+      double q_diff = 0.;
+      if (c_nbr >= 0) {
+        q_diff = trans_f[0][f] * cond_f[0][f] * (temp_c[0][c] - temp_c[0][c_nbr]);
+      } else if (markers[f] == Operators::OPERATOR_BC_DIRICHLET) {
+        q_diff = trans_f[0][f] * cond_f[0][f] * (temp_c[0][c] - values[f]);
+      } else if (markers[f] == Operators::OPERATOR_BC_NEUMANN) {
+        q_diff = values[f] * mesh_->face_area(f);
+      }
+      if (f < nfaces_owned) eflux_f[0][f] = dirs[n] * q_diff;
+
+      // advected enthalpy out of c.  A Neumann face's flux is total, and
+      // so is carried entirely by diffusion.
+      double q = dirs[n] * flux_f[0][f];
+      double q_adv = 0.;
+      if (c_nbr >= 0) {
+        q_adv = q * (q > 0. ? enth_c[0][c] : enth_c[0][c_nbr]);
+      } else if (adv_markers[f] != Operators::OPERATOR_BC_NEUMANN) {
+        if (q > 0.) {
+          q_adv = q * enth_c[0][c];
+        } else if (adv_markers[f] == Operators::OPERATOR_BC_DIRICHLET) {
+          q_adv = q * adv_values[f];
+        }
+      }
+
+      g_c[0][c] += q_diff + q_adv;
+    }
+  }
+}
+
+
+// -------------------------------------------------------------
+// Face transmissibilities for ApplyDiffusionAndAdvection_().  These depend
+// only on the mesh, so they are taken from the forward operator assembled
+// with a unit conductivity, once on a static mesh and on every evaluation on
+// a dynamic one.
+// -------------------------------------------------------------
+void EnergyBase::UpdateTransmissibility_() {
+  if (trans_ == Teuchos::null) {
+    CompositeVectorSpace space;
+    space.SetMesh(mesh_)->SetGhosted()->SetComponent("face", AmanziMesh::FACE, 1);
+    trans_ = Teuchos::rcp(new CompositeVector(space));
+  }
+
+  // Recreate mass matrices
+  if (dynamic_mesh_) matrix_diff_->SetTensorCoefficient(Teuchos::null);
+
+  matrix_diff_->global_operator()->Init();
+  matrix_diff_->SetScalarCoefficient(Teuchos::null, Teuchos::null);
+  matrix_diff_->UpdateMatrices(Teuchos::null, Teuchos::null);
+
+  Epetra_MultiVector& trans_f = *trans_->ViewComponent("face", false);
+  const auto& Aface = matrix_diff_->local_matrices()->matrices;
+  for (int f=0; f!=trans_f.MyLength(); ++f) trans_f[0][f] = Aface[f](0,0);
+  trans_->ScatterMasterToGhosted("face");
+}
+
+
 // ---------------------------------------------------------------------
 // Add in energy source, which are accumulated by a single evaluator.
 // ---------------------------------------------------------------------
@@ -24,6 +24,7 @@ Author: Ethan Coon
 #include "CompositeVectorFunction.hh"
 #include "CompositeVectorFunctionFactory.hh"
 
+#include "boundary_face_plan.hh"
 #include "energy_base.hh"
 
 #define MORE_DEBUG_FLAG 0
@@ -47,7 +48,9 @@ EnergyBase::EnergyBase(Teuchos::ParameterList& FElist,
     coupled_to_surface_via_flux_(false),
     niter_(0),
     flux_exists_(true),
-    implicit_advection_(true) {
+    implicit_advection_(true),
+    matrix_free_residual_(false),
+    dynamic_mesh_(false) {
 
   if (!plist_->isParameter("conserved quantity key suffix"))
     plist_->set("conserved quantity key suffix", "energy");
@@ -143,6 +146,18 @@ void EnergyBase::SetupEnergy_(const Teuchos::Ptr<State>& S) {
   matrix_diff_->SetTensorCoefficient(Teuchos::null);
   matrix_ = matrix_diff_->global_operator();
 
+  // -- the residual may be evaluated without assembling the forward
+  //    operators, which requires a two-point flux on upwinded faces
+  matrix_free_residual_ = plist_->get<bool>("matrix-free residual", false);
+  if (matrix_free_residual_ &&
+      (mfd_plist.get<std::string>("discretization primary") != "fv: default" ||
+       coef_location != "upwind: face")) {
+    Errors::Message message;
+    message << name_ << ": \"matrix-free residual\" requires the \"fv: default\" discretization"
+            << " and a face-upwinded conductivity.";
+    Exceptions::amanzi_throw(message);
+  }
+
   // -- create the forward operator for the advection term
   Teuchos::ParameterList advect_plist = plist_->sublist("advection");
   matrix_adv_ = Teuchos::rcp(new Operators::PDE_AdvectionUpwind(advect_plist, mesh_));
@@ -338,6 +353,9 @@ void EnergyBase::Initialize(const Teuchos::Ptr<State>& S) {
 
 #endif
 
+  // check whether this is a dynamic mesh problem
+  if (S->HasField("vertex coordinate")) dynamic_mesh_ = true;
+
   // initialize energy flux
   S->GetFieldData(energy_flux_key_, name_)->PutScalar(0.0);
   S->GetField(energy_flux_key_, name_)->set_initialized();
@@ -518,13 +536,12 @@ void EnergyBase::UpdateBoundaryConditions_(
 
   auto& adv_markers = bc_adv_->bc_model();
   auto& adv_values = bc_adv_->bc_value();
-  
-  for (unsigned int n=0; n!=markers.size(); ++n) {
-    markers[n] = Operators::OPERATOR_BC_NONE;
-    values[n] = 0.0;
-    adv_markers[n] = Operators::OPERATOR_BC_NONE;
-    adv_values[n] = 0.0;
-  }
+  const BoundaryFacePlan& plan = BoundaryFacePlan::Get(mesh_);
+
+  std::fill(markers.begin(), markers.end(), Operators::OPERATOR_BC_NONE);
+  std::fill(values.begin(), values.end(), 0.0);
+  std::fill(adv_markers.begin(), adv_markers.end(), Operators::OPERATOR_BC_NONE);
+  std::fill(adv_values.begin(), adv_values.end(), 0.0);
 
   // Dirichlet temperature boundary conditions
   for (Functions::BoundaryFunction::Iterator bc=bc_temperature_->begin();
@@ -559,14 +576,14 @@ void EnergyBase::UpdateBoundaryConditions_(
   if (coupled_to_surface_via_temp_) {
     // Face is Dirichlet with value of surface temp
     Teuchos::RCP<const AmanziMesh::Mesh> surface = S->GetMesh(Keys::getDomain(ss_flux_key_));
+    const AmanziMesh::Entity_ID_List& surface_faces = plan.SurfaceFaces(surface);
     const Epetra_MultiVector& temp = *S->GetFieldData("surface_temperature")
         ->ViewComponent("cell",false);
 
     int ncells_surface = temp.MyLength();
     for (int c=0; c!=ncells_surface; ++c) {
       // -- get the surface cell's equivalent subsurface face
-      AmanziMesh::Entity_ID f =
-        surface->entity_get_parent(AmanziMesh::CELL, c);
+      AmanziMesh::Entity_ID f = surface_faces[c];
 
       // -- set that value to dirichlet
       markers[f] = Operators::OPERATOR_BC_DIRICHLET;
@@ -581,14 +598,14 @@ void EnergyBase::UpdateBoundaryConditions_(
     // Diffusive fluxes are given by the residual of the surface equation.
     // Advective fluxes are given by the surface temperature and whatever flux we have.
     Teuchos::RCP<const AmanziMesh::Mesh> surface = S->GetMesh(Keys::getDomain(ss_flux_key_));
+    const AmanziMesh::Entity_ID_List& surface_faces = plan.SurfaceFaces(surface);
     const Epetra_MultiVector& flux =
       *S->GetFieldData(ss_flux_key_)->ViewComponent("cell",false);
 
     int ncells_surface = flux.MyLength();
     for (int c=0; c!=ncells_surface; ++c) {
       // -- get the surface cell's equivalent subsurface face
-      AmanziMesh::Entity_ID f =
-        surface->entity_get_parent(AmanziMesh::CELL, c);
+      AmanziMesh::Entity_ID f = surface_faces[c];
 
       // -- set that value to Neumann
       markers[f] = Operators::OPERATOR_BC_NEUMANN;
@@ -603,19 +620,12 @@ void EnergyBase::UpdateBoundaryConditions_(
   }
 
   // mark all remaining boundary conditions as zero diffusive flux conditions
-  AmanziMesh::Entity_ID_List cells;
-  int nfaces_owned = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
-  for (int f = 0; f < nfaces_owned; f++) {
+  for (auto f : plan.boundary_faces()) {
     if (markers[f] == Operators::OPERATOR_BC_NONE) {
-      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      int ncells = cells.size();
-
-      if (ncells == 1) {
-        markers[f] = Operators::OPERATOR_BC_NEUMANN;
-        values[f] = 0.0;
-        adv_markers[f] = Operators::OPERATOR_BC_DIRICHLET;
-        adv_values[f] = 0.0;
-      }
+      markers[f] = Operators::OPERATOR_BC_NEUMANN;
+      values[f] = 0.0;
+      adv_markers[f] = Operators::OPERATOR_BC_DIRICHLET;
+      adv_values[f] = 0.0;
     }
   }
   
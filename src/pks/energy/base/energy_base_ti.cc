@@ -69,7 +69,13 @@ void EnergyBase::FunctionalResidual(double t_old, double t_new, Teuchos::RCP<Tre
   res->PutScalar(0.0);
 
   // diffusion term, implicit
-  ApplyDiffusion_(S_next_.ptr(), res.ptr());
+  if (matrix_free_residual_) {
+    // -- advection is included in the same sweep
+    ApplyDiffusionAndAdvection_(S_next_.ptr(),
+            implicit_advection_ ? S_next_.ptr() : S_inter_.ptr(), res.ptr());
+  } else {
+    ApplyDiffusion_(S_next_.ptr(), res.ptr());
+  }
 #if DEBUG_FLAG
   db_->WriteVector("K",S_next_->GetFieldData(conductivity_key_).ptr(),true);
   db_->WriteVector("res (diff)", res.ptr(), true);
@@ -87,7 +93,9 @@ void EnergyBase::FunctionalResidual(double t_old, double t_new, Teuchos::RCP<Tre
 #endif
 
   // advection term
-  if (implicit_advection_) {
+  if (matrix_free_residual_) {
+    // already added with diffusion
+  } else if (implicit_advection_) {
     AddAdvection_(S_next_.ptr(), res.ptr(), true);
   } else {
     AddAdvection_(S_inter_.ptr(), res.ptr(), true);
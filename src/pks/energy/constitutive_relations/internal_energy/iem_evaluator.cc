@@ -8,6 +8,7 @@
 
 #include "iem_evaluator.hh"
 #include "iem_factory.hh"
+#include "shared_models.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -19,7 +20,7 @@ IEMEvaluator::IEMEvaluator(Teuchos::ParameterList& plist) :
   AMANZI_ASSERT(plist_.isSublist("IEM parameters"));
   Teuchos::ParameterList sublist = plist_.sublist("IEM parameters");
   IEMFactory fac;
-  iem_ = fac.createIEM(sublist);
+  iem_ = Utils::SharedModels<IEM>::Get(sublist, [&]() { return fac.createIEM(sublist); });
 
   InitializeFromPlist_();
 }
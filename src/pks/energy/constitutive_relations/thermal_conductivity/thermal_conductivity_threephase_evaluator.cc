@@ -9,6 +9,8 @@
 */
 
 #include "dbc.hh"
+#include "region_entity_cache.hh"
+#include "shared_models.hh"
 #include "thermal_conductivity_threephase_factory.hh"
 #include "thermal_conductivity_threephase_evaluator.hh"
 
@@ -45,9 +47,12 @@ ThermalConductivityThreePhaseEvaluator::ThermalConductivityThreePhaseEvaluator(
        lcv!=tc_sublist.end(); ++lcv) {
     std::string name = lcv->first;
     if (tc_sublist.isSublist(name)) {
-      Teuchos::ParameterList& tcp_sublist = tc_sublist.sublist(name);
+      Teuchos::ParameterList tcp_sublist = tc_sublist.sublist(name);
       std::string region_name = tcp_sublist.get<std::string>("region");
-      Teuchos::RCP<ThermalConductivityThreePhase> tc = fac.createThermalConductivityModel(tcp_sublist);
+      tcp_sublist.remove("region");
+      Teuchos::RCP<ThermalConductivityThreePhase> tc =
+          Utils::SharedModels<ThermalConductivityThreePhase>::Get(tcp_sublist,
+              [&]() { return fac.createThermalConductivityModel(tcp_sublist); });
       tcs_.push_back(std::make_pair(region_name,tc));
     } else {
       Errors::Message message("ThermalConductivityThreePhaseEvaluator: region-based lists.  (Perhaps you have an old-style input file?)");
@@ -96,8 +101,8 @@ void ThermalConductivityThreePhaseEvaluator::EvaluateField_(
       std::string region_name = lcv->first;
       if (mesh->valid_set_name(region_name, AmanziMesh::CELL)) {
         // get the indices of the domain.
-        AmanziMesh::Entity_ID_List id_list;
-        mesh->get_set_entities(region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &id_list);
+        const AmanziMesh::Entity_ID_List& id_list =
+            RegionEntityCache::Get(mesh, region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
 
         // loop over indices
         for (AmanziMesh::Entity_ID_List::const_iterator id=id_list.begin();
@@ -142,8 +147,8 @@ void ThermalConductivityThreePhaseEvaluator::EvaluateFieldPartialDerivative_(
         std::string region_name = lcv->first;
         if (mesh->valid_set_name(region_name, AmanziMesh::CELL)) {
           // get the indices of the domain.
-          AmanziMesh::Entity_ID_List id_list;
-          mesh->get_set_entities(region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &id_list);
+          const AmanziMesh::Entity_ID_List& id_list =
+              RegionEntityCache::Get(mesh, region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
 
           // loop over indices
           for (AmanziMesh::Entity_ID_List::const_iterator id=id_list.begin();
@@ -165,8 +170,8 @@ void ThermalConductivityThreePhaseEvaluator::EvaluateFieldPartialDerivative_(
         std::string region_name = lcv->first;
         if (mesh->valid_set_name(region_name, AmanziMesh::CELL)) {
           // get the indices of the domain.
-          AmanziMesh::Entity_ID_List id_list;
-          mesh->get_set_entities(region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &id_list);
+          const AmanziMesh::Entity_ID_List& id_list =
+              RegionEntityCache::Get(mesh, region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
 
           // loop over indices
           for (AmanziMesh::Entity_ID_List::const_iterator id=id_list.begin();
@@ -188,8 +193,8 @@ void ThermalConductivityThreePhaseEvaluator::EvaluateFieldPartialDerivative_(
         std::string region_name = lcv->first;
         if (mesh->valid_set_name(region_name, AmanziMesh::CELL)) {
           // get the indices of the domain.
-          AmanziMesh::Entity_ID_List id_list;
-          mesh->get_set_entities(region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &id_list);
+          const AmanziMesh::Entity_ID_List& id_list =
+              RegionEntityCache::Get(mesh, region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
 
           // loop over indices
           for (AmanziMesh::Entity_ID_List::const_iterator id=id_list.begin();
@@ -211,8 +216,8 @@ void ThermalConductivityThreePhaseEvaluator::EvaluateFieldPartialDerivative_(
         std::string region_name = lcv->first;
         if (mesh->valid_set_name(region_name, AmanziMesh::CELL)) {
           // get the indices of the domain.
-          AmanziMesh::Entity_ID_List id_list;
-          mesh->get_set_entities(region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &id_list);
+          const AmanziMesh::Entity_ID_List& id_list =
+              RegionEntityCache::Get(mesh, region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
 
           // loop over indices
           for (AmanziMesh::Entity_ID_List::const_iterator id=id_list.begin();
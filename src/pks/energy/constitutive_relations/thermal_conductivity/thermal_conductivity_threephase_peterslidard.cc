@@ -23,8 +23,8 @@ ThermalConductivityThreePhasePetersLidard::ThermalConductivityThreePhasePetersLi
 double ThermalConductivityThreePhasePetersLidard::ThermalConductivity(double poro,
         double sat_liq, double sat_ice, double temp) {
   double k_dry = (d_*(1-poro)*k_soil_ + k_gas_*poro)/(d_*(1-poro) + poro);
-  double k_sat_u = pow(k_soil_,(1-poro)) * pow(k_liquid_,poro);
-  double k_sat_f = pow(k_soil_,(1-poro)) * pow(k_ice_,poro);
+  double k_sat_u = k_soil_ * std::exp(poro * log_liquid_soil_);
+  double k_sat_f = k_soil_ * std::exp(poro * log_ice_soil_);
   double kersten_u = pow(sat_liq + eps_, alpha_u_);
   double kersten_f = pow(sat_ice + eps_, alpha_f_);
   return kersten_f * k_sat_f + kersten_u * k_sat_u
@@ -41,6 +41,10 @@ void ThermalConductivityThreePhasePetersLidard::InitializeFromPlist_() {
   k_ice_ = plist_.get<double>("thermal conductivity of ice [W/(m-K)]");
   k_liquid_ = plist_.get<double>("thermal conductivity of liquid [W/(m-K)]");
   k_gas_ = plist_.get<double>("thermal conductivity of gas [W/(m-K)]");
+
+  // k_soil^(1-poro) * k^poro == k_soil * exp(poro * log(k/k_soil))
+  log_liquid_soil_ = std::log(k_liquid_ / k_soil_);
+  log_ice_soil_ = std::log(k_ice_ / k_soil_);
 };
 
 } // namespace Relations
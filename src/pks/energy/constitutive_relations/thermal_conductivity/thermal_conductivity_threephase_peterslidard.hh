@@ -60,6 +60,8 @@ private:
   double k_liquid_;
   double k_gas_;
   double d_;
+  double log_liquid_soil_;
+  double log_ice_soil_;
 
 private:
   static Utils::RegisteredFactory<ThermalConductivityThreePhase,
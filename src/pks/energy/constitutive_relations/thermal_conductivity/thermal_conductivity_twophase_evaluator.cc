@@ -8,6 +8,7 @@
 */
 
 #include "dbc.hh"
+#include "shared_models.hh"
 #include "thermal_conductivity_twophase_factory.hh"
 #include "thermal_conductivity_twophase_evaluator.hh"
 
@@ -30,7 +31,8 @@ ThermalConductivityTwoPhaseEvaluator::ThermalConductivityTwoPhaseEvaluator(
   AMANZI_ASSERT(plist_.isSublist("thermal conductivity parameters"));
   Teuchos::ParameterList sublist = plist_.sublist("thermal conductivity parameters");
   ThermalConductivityTwoPhaseFactory fac;
-  tc_ = fac.createThermalConductivityModel(sublist);
+  tc_ = Utils::SharedModels<ThermalConductivityTwoPhase>::Get(sublist,
+          [&]() { return fac.createThermalConductivityModel(sublist); });
 }
 
 
@@ -23,7 +23,7 @@ ThermalConductivityTwoPhasePetersLidard::ThermalConductivityTwoPhasePetersLidard
 double ThermalConductivityTwoPhasePetersLidard::ThermalConductivity(double poro,
         double sat_liq) {
   double k_dry = (d_*(1-poro)*k_soil_ + k_gas_*poro)/(d_*(1-poro) + poro);
-  double k_sat = pow(k_soil_,(1-poro)) * pow(k_liquid_,poro);
+  double k_sat = k_soil_ * std::exp(poro * log_liquid_soil_);
   double kersten = pow(sat_liq + eps_, alpha_);
   return k_dry + (k_sat - k_dry)*kersten;
 };
@@ -36,6 +36,9 @@ void ThermalConductivityTwoPhasePetersLidard::InitializeFromPlist_() {
   k_soil_ = plist_.get<double>("thermal conductivity of soil [W/(m-K)]");
   k_liquid_ = plist_.get<double>("thermal conductivity of liquid [W/(m-K)]");
   k_gas_ = plist_.get<double>("thermal conductivity of gas [W/(m-K)]");
+
+  // k_soil^(1-poro) * k_liquid^poro == k_soil * exp(poro * log(k_liquid/k_soil))
+  log_liquid_soil_ = std::log(k_liquid_ / k_soil_);
 };
 
 } // namespace Relations
@@ -58,6 +58,7 @@ private:
   double k_liquid_;
   double k_gas_;
   double d_;
+  double log_liquid_soil_;
 
 private:
   static Utils::RegisteredFactory<ThermalConductivityTwoPhase,
@@ -46,20 +46,22 @@ double ManningConductivityModel::DConductivityDDepth(double depth, double slope,
   return std::pow(std::max(depth,0.), exponent - 1.) * exponent / scaling;
 }
 
-double ManningConductivityModel::DConductivityDDepth(double depth, double slope, double coef, double pd_depth, double frac_cond, double beta) {  
+// Subgrid conductivity is frac^(1+beta) * pdd^(1+exponent) / scaling, and
+// does not depend upon depth directly.  This is the derivative with respect
+// to the ponded depth minus depression depth.
+double ManningConductivityModel::DConductivityDDepth(double depth, double slope, double coef, double pd_depth, double frac_cond, double beta) {
   if (pd_depth <= 0.) return 0.;
-  //Errors::Message message("Manning Conductivity Model: Derivaritve not implemented for the Subgrid Model."); 
-  // Exceptions::amanzi_throw(message);
-  std::cout<<"Manning Conductivity Model: Derivaritve not implemented for the Subgrid Model.\n"; abort();  
   double exponent = manning_exp_;
   double scaling = coef * std::sqrt(std::max(slope, slope_regularization_));
-  double Dpd1 = depth*std::pow(std::max(pd_depth,0.), exponent - 1.)*exponent;
-  double Dpd2 = std::pow(std::max(pd_depth,0.), exponent);
-  return 0;
-  //return  (Dpd1  + Dpd2) / (scaling * hdmax);
-  }
-
+  return frac_cond * std::pow(frac_cond, beta) * (exponent + 1.) * std::pow(pd_depth, exponent) / scaling;
+}
 
+double ManningConductivityModel::DConductivityDFracCond(double depth, double slope, double coef, double pd_depth, double frac_cond, double beta) {
+  if (pd_depth <= 0.) return 0.;
+  double exponent = manning_exp_;
+  double scaling = coef * std::sqrt(std::max(slope, slope_regularization_));
+  return (1. + beta) * std::pow(frac_cond, beta) * pd_depth * std::pow(pd_depth, exponent) / scaling;
+}
 
 
 } // namespace
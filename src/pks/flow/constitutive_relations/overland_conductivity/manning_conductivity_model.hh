@@ -28,6 +28,7 @@ public:
   //Added for the subgrid Model
   virtual double Conductivity(double depth, double slope, double coef, double pd_depth, double frac_cond, double beta);  
   virtual double DConductivityDDepth(double depth, double slope, double coef, double pd_depth, double frac, double beta);
+  virtual double DConductivityDFracCond(double depth, double slope, double coef, double pd_depth, double frac, double beta);
 
 protected:
   Teuchos::ParameterList plist_;
@@ -45,7 +45,6 @@ OverlandConductivityEvaluator::OverlandConductivityEvaluator(Teuchos::ParameterL
   }
 
   sg_model_ =  plist_.get<bool>("subgrid model", false);
-  AMANZI_ASSERT(!sg_model_);
   if(sg_model_){
     pdd_key_ = Keys::readKey(plist_, domain, "ponded depth minus depression depth", "ponded_depth_minus_depression_depth");
     dependencies_.insert(pdd_key_);
@@ -195,11 +194,11 @@ void OverlandConductivityEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
 void OverlandConductivityEvaluator::EvaluateFieldPartialDerivative_(
     const Teuchos::Ptr<State>& S,
     Key wrt_key, const Teuchos::Ptr<CompositeVector>& result) {
-   //never called otherwsise it needs to changed for subgrid model
-  if (sg_model_){
-    Errors::Message message("Overland Conductivity Evaluator: Evaluate partial derivaritve not implemented for the Subgrid Model."); 
-    Exceptions::amanzi_throw(message);
+  if (sg_model_) {
+    EvaluateSubgridPartialDerivative_(S, wrt_key, result);
+    return;
   }
+
   Teuchos::RCP<const CompositeVector> depth = S->GetFieldData(depth_key_);
   Teuchos::RCP<const CompositeVector> slope = S->GetFieldData(slope_key_);
   Teuchos::RCP<const CompositeVector> coef = S->GetFieldData(coef_key_);
@@ -271,6 +270,64 @@ void OverlandConductivityEvaluator::EvaluateFieldPartialDerivative_(
 }
 
 
+// The subgrid conductivity depends upon ponded depth only through the ponded
+// depth minus depression depth and the fractional conductance, so those are
+// the only nonzero derivatives (other than density).
+void OverlandConductivityEvaluator::EvaluateSubgridPartialDerivative_(
+    const Teuchos::Ptr<State>& S,
+    Key wrt_key, const Teuchos::Ptr<CompositeVector>& result) {
+  bool wrt_dens = dens_ && wrt_key == dens_key_;
+  if (wrt_key != pdd_key_ && wrt_key != frac_cond_key_ && !wrt_dens) {
+    // FIX ME -- need to add derivatives of conductivity model wrt slope, coef, drag --etc
+    result->PutScalar(0.);
+    return;
+  }
+
+  Teuchos::RCP<const CompositeVector> depth = S->GetFieldData(depth_key_);
+  Teuchos::RCP<const CompositeVector> slope = S->GetFieldData(slope_key_);
+  Teuchos::RCP<const CompositeVector> coef = S->GetFieldData(coef_key_);
+  Teuchos::RCP<const CompositeVector> pd_depth = S->GetFieldData(pdd_key_);
+  Teuchos::RCP<const CompositeVector> frac_cond = S->GetFieldData(frac_cond_key_);
+  Teuchos::RCP<const CompositeVector> drag = S->GetFieldData(drag_exp_key_);
+
+  for (CompositeVector::name_iterator comp=result->begin();
+       comp!=result->end(); ++comp) {
+    const Epetra_MultiVector& depth_v = *depth->ViewComponent(*comp,false);
+    const Epetra_MultiVector& slope_v = *slope->ViewComponent(*comp,false);
+    const Epetra_MultiVector& coef_v = *coef->ViewComponent(*comp,false);
+    const Epetra_MultiVector& pd_depth_v = *pd_depth->ViewComponent(*comp,false);
+    const Epetra_MultiVector& frac_cond_v = *frac_cond->ViewComponent(*comp,false);
+    const Epetra_MultiVector& drag_v = *drag->ViewComponent(*comp,false);
+    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+
+    int ncomp = result->size(*comp, false);
+    if (wrt_key == pdd_key_) {
+      for (int i=0; i!=ncomp; ++i) {
+        result_v[0][i] = model_->DConductivityDDepth(depth_v[0][i], slope_v[0][i], coef_v[0][i],
+                pd_depth_v[0][i], frac_cond_v[0][i], drag_v[0][i]);
+      }
+    } else if (wrt_key == frac_cond_key_) {
+      for (int i=0; i!=ncomp; ++i) {
+        result_v[0][i] = model_->DConductivityDFracCond(depth_v[0][i], slope_v[0][i], coef_v[0][i],
+                pd_depth_v[0][i], frac_cond_v[0][i], drag_v[0][i]);
+      }
+    } else {
+      for (int i=0; i!=ncomp; ++i) {
+        result_v[0][i] = model_->Conductivity(depth_v[0][i], slope_v[0][i], coef_v[0][i],
+                pd_depth_v[0][i], frac_cond_v[0][i], drag_v[0][i]);
+      }
+    }
+
+    if (dens_ && !wrt_dens) {
+      const Epetra_MultiVector& dens_v = *S->GetFieldData(dens_key_)->ViewComponent(*comp,false);
+      for (int i=0; i!=ncomp; ++i) {
+        result_v[0][i] *= dens_v[0][i];
+      }
+    }
+  }
+}
+
+
 } //namespace
 } //namespace
 
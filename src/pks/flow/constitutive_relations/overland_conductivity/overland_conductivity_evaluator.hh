@@ -32,6 +32,10 @@ class OverlandConductivityEvaluator : public SecondaryVariableFieldEvaluator {
 
   Teuchos::RCP<OverlandConductivityModel> get_Model() { return model_; }
 
+protected:
+  void EvaluateSubgridPartialDerivative_(const Teuchos::Ptr<State>& S,
+          Key wrt_key, const Teuchos::Ptr<CompositeVector>& result);
+
 private:
   Teuchos::RCP<OverlandConductivityModel> model_;
 
@@ -27,6 +27,9 @@ class OverlandConductivityModel {
   virtual double DConductivityDDepth(double depth, double slope, double coef, double p, double frac, double beta) {
     return DConductivityDDepth(depth, slope, coef);
   }
+  virtual double DConductivityDFracCond(double depth, double slope, double coef, double p, double frac, double beta) {
+    return 0.;
+  }
 };
 
 } // namespace
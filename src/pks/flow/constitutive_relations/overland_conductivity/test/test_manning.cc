@@ -0,0 +1,50 @@
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "manning_conductivity_model.hh"
+
+// Analytic derivatives of the Manning conductivity, including the subgrid
+// form, against centered finite differences.
+TEST(ManningConductivityDerivatives) {
+  using namespace Amanzi::Flow;
+
+  Teuchos::ParameterList plist;
+  plist.set("Manning exponent", 2./3);
+  ManningConductivityModel manning(plist);
+
+  double slope = 0.01;
+  double coef = 0.05;
+  double beta = 0.5;
+  double eps = 1.e-7;
+
+  std::vector<double> depths = { 1.e-3, 0.01, 0.1, 1.0 };
+  std::vector<double> fracs = { 0.1, 0.5, 1.0 };
+
+  for (double depth : depths) {
+    double fd = (manning.Conductivity(depth+eps, slope, coef)
+                 - manning.Conductivity(depth-eps, slope, coef)) / (2*eps);
+    CHECK_CLOSE(fd, manning.DConductivityDDepth(depth, slope, coef), 1.e-6 * std::abs(fd));
+
+    for (double frac : fracs) {
+      // subgrid conductivity depends upon the ponded depth minus depression
+      // depth and the fraction conducting, not the depth itself
+      double pdd = 0.5 * depth;
+      double fd_pdd = (manning.Conductivity(depth, slope, coef, pdd+eps, frac, beta)
+                       - manning.Conductivity(depth, slope, coef, pdd-eps, frac, beta)) / (2*eps);
+      CHECK_CLOSE(fd_pdd, manning.DConductivityDDepth(depth, slope, coef, pdd, frac, beta),
+                  1.e-6 * std::abs(fd_pdd));
+
+      double fd_frac = (manning.Conductivity(depth, slope, coef, pdd, frac+eps, beta)
+                        - manning.Conductivity(depth, slope, coef, pdd, frac-eps, beta)) / (2*eps);
+      CHECK_CLOSE(fd_frac, manning.DConductivityDFracCond(depth, slope, coef, pdd, frac, beta),
+                  1.e-6 * std::abs(fd_frac));
+    }
+  }
+
+  // no ponded water, no conductivity or derivatives
+  CHECK_EQUAL(0., manning.DConductivityDDepth(0., slope, coef));
+  CHECK_EQUAL(0., manning.DConductivityDDepth(0.1, slope, coef, 0., 0.5, beta));
+  CHECK_EQUAL(0., manning.DConductivityDFracCond(0.1, slope, coef, 0., 0.5, beta));
+}
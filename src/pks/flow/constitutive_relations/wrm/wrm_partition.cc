@@ -6,6 +6,7 @@
 */
 
 #include "dbc.hh"
+#include "shared_models.hh"
 #include "wrm_factory.hh"
 #include "wrm_permafrost_factory.hh"
 #include "wrm_partition.hh"
@@ -27,7 +28,12 @@ createWRMPartition(Teuchos::ParameterList& plist) {
     if (plist.isSublist(name)) {
       Teuchos::ParameterList sublist = plist.sublist(name);
       region_list.push_back(sublist.get<std::string>("region"));
-      wrm_list.push_back(fac.createWRM(sublist));
+
+      // the region is only used by the partition, so columns (and the WRM
+      // and rel perm evaluators) may share WRMs
+      sublist.remove("region");
+      wrm_list.push_back(Utils::SharedModels<WRM>::Get(sublist,
+              [&]() { return fac.createWRM(sublist); }));
     } else {
       AMANZI_ASSERT(0);
     }
@@ -51,7 +57,8 @@ createWRMPermafrostModelPartition(Teuchos::ParameterList& plist,
 
   for (WRMList::const_iterator wrm=wrms->second.begin();
        wrm!=wrms->second.end(); ++wrm) {
-    pm_list.push_back(fac.createWRMPermafrostModel(plist, *wrm));
+    pm_list.push_back(Utils::SharedModels<WRMPermafrostModel>::Get(plist,
+            [&]() { return fac.createWRMPermafrostModel(plist, *wrm); }, wrm->get()));
   }
 
   return Teuchos::rcp(new WRMPermafrostModelPartition(wrms->first, pm_list));
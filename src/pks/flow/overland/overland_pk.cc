@@ -32,6 +32,7 @@ Author: Ethan Coon (ecoon@lanl.gov)
 #include "UpwindFluxFactory.hh"
 #include "PDE_DiffusionFactory.hh"
 
+#include "boundary_face_plan.hh"
 #include "overland.hh"
 
 namespace Amanzi {
@@ -472,15 +473,13 @@ void OverlandFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>& S) {
   if (vo_->os_OK(Teuchos::VERB_EXTREME))
     *vo_->os() << "  Updating BCs." << std::endl;
 
-  AmanziMesh::Entity_ID_List cells;
+  const BoundaryFacePlan& plan = BoundaryFacePlan::Get(mesh_);
   const Epetra_MultiVector& elevation = *S->GetFieldData(Keys::getKey(domain_,"elevation"))
       ->ViewComponent("face",false);
 
   // initialize all as null
-  for (unsigned int n=0; n!=bc_markers_.size(); ++n) {
-    bc_markers_[n] = Operators::OPERATOR_BC_NONE;
-    bc_values_[n] = 0.0;
-  }
+  std::fill(bc_markers_.begin(), bc_markers_.end(), Operators::OPERATOR_BC_NONE);
+  std::fill(bc_values_.begin(), bc_values_.end(), 0.0);
 
   // Head BCs are standard Dirichlet, plus elevation
   for (Functions::BoundaryFunction::Iterator bc=bc_head_->begin();
@@ -516,8 +515,7 @@ void OverlandFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>& S) {
            bc != bc_seepage_head_->end(); ++bc) {
         int f = bc->first;
 
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-        int c = cells[0];
+        int c = plan.BoundaryCell(f);
 
         double hz_f = bc->second + elevation[0][f];
         double hz_c = h_c[0][c] + elevation_c[0][c];
@@ -535,8 +533,7 @@ void OverlandFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>& S) {
       for (Functions::BoundaryFunction::Iterator bc = bc_seepage_head_->begin(); 
            bc != bc_seepage_head_->end(); ++bc) {
         int f = bc->first;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-        int c = cells[0];
+        int c = plan.BoundaryCell(f);
 
         double hz_f = bc->second + elevation[0][f];
         double hz_c = h_c[0][c] + elevation_c[0][c];
@@ -564,8 +561,7 @@ void OverlandFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>& S) {
     for (Functions::BoundaryFunction::Iterator bc = bc_critical_depth_->begin();
          bc != bc_critical_depth_->end(); ++bc) {
       int f = bc->first;
-      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      int c = cells[0];
+      int c = plan.BoundaryCell(f);
       
       bc_markers_[f] = Operators::OPERATOR_BC_NEUMANN;
       bc_values_[f] = sqrt(gz)*std::pow(h_c[0][c], 1.5)*nliq_c[0][c];
@@ -573,18 +569,7 @@ void OverlandFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>& S) {
   }
   
   // mark all remaining boundary conditions as zero flux conditions
-  int nfaces_owned = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
-  for (int f = 0; f < nfaces_owned; f++) {
-    if (bc_markers_[f] == Operators::OPERATOR_BC_NONE) {
-      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      int ncells = cells.size();
-
-      if (ncells == 1) {
-        bc_markers_[f] = Operators::OPERATOR_BC_NEUMANN;
-        bc_values_[f] = 0.0;
-      }
-    }
-  }
+  plan.MarkDefault(bc_markers_, bc_values_);
   
 }
 
@@ -39,6 +39,7 @@ Author: Ethan Coon (ecoon@lanl.gov)
 #include "UpwindFluxFactory.hh"
 #include "PDE_DiffusionFactory.hh"
 
+#include "boundary_face_plan.hh"
 #include "overland_pressure.hh"
 
 namespace Amanzi {
@@ -756,16 +757,14 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
   auto& markers = bc_markers();
   auto& values = bc_values();
 
-  AmanziMesh::Entity_ID_List cells;
+  const BoundaryFacePlan& plan = BoundaryFacePlan::Get(mesh_);
 
   const Epetra_MultiVector& elevation = *S->GetFieldData(Keys::getKey(domain_,"elevation"))
       ->ViewComponent("face",false);
 
   // initialize all as null
-  for (unsigned int n=0; n!=markers.size(); ++n) {
-    markers[n] = Operators::OPERATOR_BC_NONE;
-    values[n] = 0.0;
-  }
+  std::fill(markers.begin(), markers.end(), Operators::OPERATOR_BC_NONE);
+  std::fill(values.begin(), values.end(), 0.0);
 
   // Head BCs are standard Dirichlet, plus elevation
   for (Functions::BoundaryFunction::Iterator bc=bc_head_->begin();
@@ -794,8 +793,7 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
       for (Functions::BoundaryFunction::Iterator bc = bc_pressure_->begin(); 
            bc != bc_pressure_->end(); ++bc) {
         int f = bc->first;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-        int c = cells[0];
+        int c = plan.BoundaryCell(f);
 
         double p0 = bc->second > p_atm ? bc->second : p_atm;
         double h0 = (p0 - p_atm) / ((eta[0][c]*rho_l[0][c] + (1.-eta[0][c])*rho_i[0][c]) * gz);
@@ -809,8 +807,7 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
       for (Functions::BoundaryFunction::Iterator bc = bc_pressure_->begin(); 
            bc != bc_pressure_->end(); ++bc) {
         int f = bc->first;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-        int c = cells[0];
+        int c = plan.BoundaryCell(f);
 
         double p0 = bc->second > p_atm ? bc->second : p_atm;
         double h0 = (p0 - p_atm) / (rho_l[0][c] * gz);
@@ -855,8 +852,7 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
     for (Functions::BoundaryFunction::Iterator bc = bc_seepage_head_->begin(); 
          bc != bc_seepage_head_->end(); ++bc) {
       int f = bc->first;
-      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      int c = cells[0];
+      int c = plan.BoundaryCell(f);
 
       double hz_f = bc->second + elevation[0][f];
       double hz_c = h_c[0][c] + elevation_c[0][c];
@@ -889,8 +885,7 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
       for (Functions::BoundaryFunction::Iterator bc = bc_seepage_pressure_->begin(); 
            bc != bc_seepage_pressure_->end(); ++bc) {
         int f = bc->first;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-        int c = cells[0];
+        int c = plan.BoundaryCell(f);
 
         double p0 = bc->second > p_atm ? bc->second : p_atm;
         double h0 = (p0 - p_atm) / ((eta[0][c]*rho_l[0][c] + (1.-eta[0][c])*rho_i[0][c]) * gz);
@@ -910,8 +905,7 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
       for (Functions::BoundaryFunction::Iterator bc = bc_seepage_pressure_->begin(); 
            bc != bc_seepage_pressure_->end(); ++bc) {
         int f = bc->first;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-        int c = cells[0];
+        int c = plan.BoundaryCell(f);
 
         double p0 = bc->second > p_atm ? bc->second : p_atm;
         double h0 = (p0 - p_atm) / (rho_l[0][c] * gz);
@@ -940,8 +934,7 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
     for (Functions::BoundaryFunction::Iterator bc = bc_critical_depth_->begin();
          bc != bc_critical_depth_->end(); ++bc) {
       int f = bc->first;
-      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      int c = cells[0];
+      int c = plan.BoundaryCell(f);
       
       markers[f] = Operators::OPERATOR_BC_NEUMANN;
       values[f] = sqrt(gz)*std::pow(h_c[0][c], 1.5)*nliq_c[0][c];
@@ -951,20 +944,14 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
   // check that there are no internal faces and mark all remaining boundary conditions as zero flux conditions
   int nfaces_owned = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
   for (int f = 0; f < nfaces_owned; f++) {
-    mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-    int ncells = cells.size();
-
-    if ((markers[f] != Operators::OPERATOR_BC_NONE) && (ncells == 2)) {
+    if ((markers[f] != Operators::OPERATOR_BC_NONE) && !plan.IsBoundary(f)) {
       std::stringstream mesg_stream;
       mesg_stream << "Tried to set a boundary condition on an internal face ";
       Errors::Message mesg(mesg_stream.str());
       amanzi_throw(mesg);
     }
-    if ((markers[f] == Operators::OPERATOR_BC_NONE) && (ncells == 1)) {
-        markers[f] = Operators::OPERATOR_BC_NEUMANN;
-        values[f] = 0.0;
-    }
-  } 
+  }
+  plan.MarkDefault(markers, values);
 }
 
 
@@ -7,7 +7,8 @@
   Authors: Ethan Coon (ATS version) (ecoon@lanl.gov)
 */
 
-#include "boost/math/tools/roots.hpp"
+#include <algorithm>
+
 #include "predictor_delegate_bc_flux.hh"
 
 #include "Op.hh"
@@ -15,159 +16,158 @@
 namespace Amanzi {
 namespace Flow {
 
-#define DEBUG_FLAG 0
-
 bool PredictorDelegateBCFlux::ModifyPredictor(const Teuchos::Ptr<CompositeVector>& u) {
-  Epetra_MultiVector& u_f = *u->ViewComponent("face",false);
+  if (face_cell_.empty()) InitializeFaceGeometry_();
+
+  // neighboring faces of a boundary cell may be ghosts
+  u->ScatterMasterToGhosted();
+  Epetra_MultiVector& u_f = *u->ViewComponent("face",true);
+  const Epetra_MultiVector& u_c = *u->ViewComponent("cell",true);
+  const Epetra_MultiVector& kr_f = *S_next_->GetFieldData(uw_kr_key_)
+                                   ->ViewComponent("face",false);
+  const Epetra_MultiVector& rhs_f = *matrix_->global_operator()->rhs()
+                                    ->ViewComponent("face",false);
 
   int nfaces = bc_values_->size();
+  int nmodified = 0;
+  int nfailed = 0;
+  int total_its = 0;
   for (int f=0; f!=nfaces; ++f) {
     if ((*bc_markers_)[f] == Operators::OPERATOR_BC_NEUMANN) {
       double lambda = u_f[0][f];
       // only do if below saturated
       if (lambda < 101325.) {
-        int ierr = CalculateLambdaToms_(f, u, lambda);
-        AMANZI_ASSERT(!ierr);
-        if (!ierr) u_f[0][f] = lambda;
+        int its = CalculateLambda_(f, u_c, u_f, kr_f, rhs_f, lambda);
+        if (its < 0) {
+          nfailed++;
+        } else {
+          u_f[0][f] = lambda;
+          nmodified++;
+          total_its += its;
+        }
       }
     }
   }
+
+  if (vo_ != Teuchos::null && vo_->os_OK(Teuchos::VERB_HIGH)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "  flux BC predictor: modified " << nmodified << " faces in "
+               << total_its << " total iterations";
+    if (nfailed > 0) *vo_->os() << ", " << nfailed << " faces failed to converge";
+    *vo_->os() << std::endl;
+  }
   return true;
 }
 
 
-Teuchos::RCP<PredictorDelegateBCFlux::FluxBCFunctor>
-PredictorDelegateBCFlux::CreateFunctor_(int f,
-        const Teuchos::Ptr<const CompositeVector>& pres) {
-  // inner cell
-  AmanziMesh::Entity_ID_List cells;
-  mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-  AMANZI_ASSERT(cells.size() == 1);
-  int c = cells[0];
+void PredictorDelegateBCFlux::InitializeFaceGeometry_() {
+  int nfaces = bc_values_->size();
+  face_cell_.assign(nfaces, -1);
+  face_index_.assign(nfaces, -1);
+  face_begin_.assign(nfaces+1, 0);
+  nbr_faces_.clear();
 
-  // that cell's faces
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> dirs;
-  mesh_->cell_get_faces_and_dirs(c, &faces, &dirs);
+  AmanziMesh::Entity_ID_List cells, faces;
+  for (int f=0; f!=nfaces; ++f) {
+    face_begin_[f] = nbr_faces_.size();
+    mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+    if (cells.size() != 1) continue;
+
+    int c = cells[0];
+    mesh_->cell_get_faces(c, &faces);
+    unsigned int n = std::find(faces.begin(), faces.end(), f) - faces.begin();
+    AMANZI_ASSERT(n != faces.size());
+
+    face_cell_[f] = c;
+    face_index_[f] = n;
+    nbr_faces_.insert(nbr_faces_.end(), faces.begin(), faces.end());
+  }
+  face_begin_[nfaces] = nbr_faces_.size();
+}
 
-  // index within that cell's faces
-  unsigned int n = std::find(faces.begin(), faces.end(), f) - faces.begin();
-  AMANZI_ASSERT(n != faces.size());
 
-  Teuchos::RCP< std::vector<double> > Aff = Teuchos::rcp(new std::vector<double>());
-  Aff->resize(faces.size());
-  Teuchos::RCP< std::vector<double> > lambda = Teuchos::rcp(new std::vector<double>());
-  lambda->resize(faces.size());
+// The flux through face n of cell c, at face pressure p, is
+//
+//   r(p) = kr(p) * (B - A_nn * p + g) - q_bc
+//
+// where B collects the cell and other-face contributions of the (unscaled)
+// local matrix row and g is the gravity flux.  r is monotone in p, so the
+// root is bracketed as iterates are taken, and a Newton step which leaves
+// the bracket is replaced by bisection.
+int PredictorDelegateBCFlux::CalculateLambda_(int f,
+        const Epetra_MultiVector& pres_c,
+        const Epetra_MultiVector& pres_f,
+        const Epetra_MultiVector& kr_f,
+        const Epetra_MultiVector& rhs_f,
+        double& lambda) {
+  const double patm = 101325.;
+  int c = face_cell_[f];
+  AMANZI_ASSERT(c >= 0);
+  int n = face_index_[f];
+  const WhetStone::DenseMatrix& Acell = matrix_->local_matrices()->matrices[c];
 
   // unscale the Aff for my cell with the rel perm that was used to calculate it
-  double Krel = (*S_next_->GetFieldData(uw_kr_key_)
-                 ->ViewComponent("face",false))[0][f];
-
-  // fill the arrays
-  for (unsigned int i=0; i!=faces.size(); ++i) {
-    (*Aff)[i] = matrix_->local_matrices()->matrices[c](n,i) / Krel;
-    (*lambda)[i] = (*pres)("face",faces[i]);
+  double Krel_uw = kr_f[0][f];
+  double cell_p = pres_c[0][c];
+  double B = 0.;
+  for (int i=0; i!=face_begin_[f+1]-face_begin_[f]; ++i) {
+    double Aff = Acell(n,i) / Krel_uw;
+    B += Aff * cell_p;
+    if (i != n) B -= Aff * pres_f[0][nbr_faces_[face_begin_[f]+i]];
   }
+  double Ann = Acell(n,n) / Krel_uw;
 
-  // gravity flux
   double bc_flux = mesh_->face_area(f) * (*bc_values_)[f];
-  double gflux = ((*matrix_->global_operator()->rhs()->ViewComponent("face",false))[0][faces[n]] + bc_flux) / Krel;
-
-#if DEBUG_FLAG
-  std::cout << "   Aff = ";
-  for (unsigned int i=0; i!=faces.size(); ++i) std::cout << (*Aff)[i] << ", ";
-  std::cout << std::endl << "   lambda = ";
-  for (unsigned int i=0; i!=faces.size(); ++i) std::cout << (*lambda)[i] << ", ";
-  std::cout << std::endl << "   p_cell = " << (*pres)("cell",c) << std::endl;
-  std::cout << "    and init K_rel = " << wrms_->second[(*wrms_->first)[c]]->k_relative(wrms_->second[(*wrms_->first)[c]]->saturation(101325. - (*lambda)[n])) << std::endl;
-  std::cout << "    to match fluxes: bc = " << bc_flux << " and grav = " << gflux << std::endl;
-#endif
-
-  // create and return
-  return Teuchos::rcp(new FluxBCFunctor(Aff, lambda, n, (*pres)("cell",c),
-          bc_flux, gflux, dirs[n], 101325.0, wrms_->second[(*wrms_->first)[c]]));
-}
-
-int PredictorDelegateBCFlux::CalculateLambdaToms_(int f,
-        const Teuchos::Ptr<const CompositeVector>& pres, double& lambda) {
-
-#if DEBUG_FLAG
-  std::cout << " Flux correcting face " << f << ": q = " << (*bc_values_)[f] << std::endl;
-#endif
-
-  // start by making sure lambda is a reasonable guess, which may not be the case
-  if (std::abs(lambda) > 1.e7) lambda = 101325.;
-
-  Teuchos::RCP<FluxBCFunctor> func = CreateFunctor_(f,pres);
+  double gflux = (rhs_f[0][f] + bc_flux) / Krel_uw;
+  const Teuchos::RCP<Flow::WRM>& wrm = wrms_->second[(*wrms_->first)[c]];
 
   // -- convergence criteria
   double eps = std::max(1.e-4 * std::abs((*bc_values_)[f]), 1.e-8);
-  Tol_ tol(eps);
-  boost::uintmax_t max_it = 100;
-  boost::uintmax_t actual_it(max_it);
-
-  double res = (*func)(lambda);
-  double left = 0.;
-  double right = 0.;
-  double lres = 0.;
-  double rres = 0.;
-
-  if (res == 0) return 0;
-    
-
-  if (res > 0.) {
-    left = lambda;
-    lres = res;
-    right = std::max(lambda,101325.);
-    rres = (*func)(right);
-    while (rres > 0.) {
-      right += 101325.;
-      rres = (*func)(right);
-    }
+  const int max_it = 100;
 
-  } else {
-    right = lambda;
-    rres = res;
-
-    std::cout << "RIGHT = " << right << ", " << rres << std::endl;
-    left = std::min(101325., lambda);
-    lres = (*func)(left);
-    while (lres < 0.) {
-      std::cout << "LEFT = " << left << ", " << lres << std::endl;
-      left -= 101325.;
-      lres = (*func)(left);
+  // start by making sure lambda is a reasonable guess, which may not be the case
+  if (std::abs(lambda) > 1.e7) lambda = patm;
+
+  double left = -1.e99, right = 1.e99;
+  double p = lambda;
+  for (int it=0; it!=max_it; ++it) {
+    double sat = wrm->saturation(patm - p);
+    double kr = wrm->k_relative(sat);
+    double flux = B - Ann * p + gflux;
+    double res = kr * flux - bc_flux;
+
+    if (std::abs(res) <= eps) {
+      lambda = p;
+      return it;
     }
-  }
-
-#if DEBUG_FLAG
-  std::cout << "   bracket (res): " << left << " (" << lres << "), "
-            << right << " (" << rres << ")" << std::endl;
-#endif
-
-  std::pair<double,double> result =
-      boost::math::tools::toms748_solve(*func, left, right, lres, rres, tol, actual_it);
-  if (actual_it >= max_it) {
-    std::cout << " Failed to converged in " << actual_it << " steps." << std::endl;
-    return 3;
-  }
 
-  lambda = (result.first + result.second) / 2.;
-#if DEBUG_FLAG
-  std::cout << "  Converged to " << lambda << " in " << actual_it << " steps." << std::endl;
+    // update the bracket: r is decreasing in p
+    if (res > 0.) left = p;
+    else right = p;
 
-  AmanziMesh::Entity_ID_List cells;
-  mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-  AMANZI_ASSERT(cells.size() == 1);
-  int c = cells[0];
-
-  std::cout << "      with k_rel = " << wrms_->second[(*wrms_->first)[c]]->k_relative(wrms_->second[(*wrms_->first)[c]]->saturation(101325. - lambda)) << std::endl;
+    // Newton step, d(kr)/dp = -d(kr)/ds * ds/dpc
+    double dkr = -wrm->d_k_relative(sat) * wrm->d_saturation(patm - p);
+    double dres = dkr * flux - kr * Ann;
+    double p_new = dres != 0. ? p - res / dres : p;
 
+    // safeguard: take bounded steps until the root is bracketed, then
+    // bisect whenever Newton leaves the bracket
+    if (left == -1.e99 || right == 1.e99) {
+      if (dres == 0. || std::abs(p_new - p) > patm || (res > 0.) != (p_new > p)) {
+        p_new = res > 0. ? p + patm : p - patm;
+      }
+    } else if (!(p_new > left && p_new < right)) {
+      p_new = (left + right) / 2.;
+    }
 
-#endif
-  return 0;
+    if (std::abs(p_new - p) <= 1.e-10 * patm) {
+      lambda = p_new;
+      return it+1;
+    }
+    p = p_new;
+  }
+  return -1;
 }
 
-
-
 } // namespace
 } // namespace
@@ -12,6 +12,7 @@
 
 #include "Mesh.hh"
 #include "State.hh"
+#include "VerboseObject.hh"
 
 #include "TreeVector.hh"
 #include "PDE_Diffusion.hh"
@@ -29,14 +30,16 @@ class PredictorDelegateBCFlux {
                           const Teuchos::RCP<Flow::WRMPartition>& wrms,
                           std::vector<int>* bc_markers,
                           std::vector<double>* bc_values,
-                          const std::string& uw_kr_key) :
+                          const std::string& uw_kr_key,
+                          const Teuchos::RCP<VerboseObject>& vo) :
       S_next_(S_next),
       mesh_(mesh),
       matrix_(matrix),
       wrms_(wrms),
       bc_markers_(bc_markers),
       bc_values_(bc_values),
-      uw_kr_key_(uw_kr_key)
+      uw_kr_key_(uw_kr_key),
+      vo_(vo)
   {}
 
   bool ModifyPredictor(double h, Teuchos::RCP<TreeVector> u) {
@@ -46,71 +49,18 @@ class PredictorDelegateBCFlux {
   bool ModifyPredictor(const Teuchos::Ptr<CompositeVector>& u);
 
  protected:
-
-  class FluxBCFunctor {
-   public:
-    FluxBCFunctor(const Teuchos::RCP< std::vector<double> > Aff,
-                  const Teuchos::RCP< std::vector<double> > lambda,
-                  int face_index,
-                  double cell_p,
-                  double bc_flux,
-                  double g_flux,
-                  int dir,
-                  double patm,
-                  const Teuchos::RCP<Flow::WRM>& wrm) :
-        Aff_(Aff), lambda_(lambda), face_index_(face_index),
-        cell_p_(cell_p), bc_flux_(bc_flux), g_flux_(g_flux),
-        wrm_(wrm), dir_(dir), patm_(patm) {
-    }
-
-    double operator()(double face_p) {
-      (*lambda_)[face_index_] = face_p;
-      double Krel = wrm_->k_relative(wrm_->saturation(patm_ - face_p));
-      //      std::cout << "Fluxes: " << std::endl;
-      double q = flux_();
-      //      std::cout << "  K grad p = " << q << ", K grad gz = " << g_flux_*Krel << ", bc = " << bc_flux_ << std::endl;
-      return flux_() + g_flux_*Krel - bc_flux_;
-    }
-
-   protected:
-
-    double flux_() {
-      double s = 0.;
-      double Krel = wrm_->k_relative(wrm_->saturation(patm_ - (*lambda_)[face_index_]));
-
-      //      std::cout << "  Krel = " << Krel << std::endl;
-      //      std::cout << "  lambda_bc = " << (*lambda_)[face_index_] << std::endl;
-      for (unsigned int n=0; n!=lambda_->size(); ++n)
-        s += (*Aff_)[n] * Krel * (cell_p_ - (*lambda_)[n]);
-      return s;
-    }
-
-   protected:
-    Teuchos::RCP< std::vector<double> > Aff_;
-    Teuchos::RCP< std::vector<double> > lambda_;
-    int face_index_;
-    double face_Mff_;
-    double cell_p_;
-    double bc_flux_;
-    double g_flux_;
-    int dir_;
-    double patm_;
-    Teuchos::RCP<Flow::WRM> wrm_;
-  };
-
-  struct Tol_ {
-    Tol_(double eps) : eps_(eps) {}
-    bool operator()(const double& a, const double& b) const {
-      return std::abs(a - b) <= eps_;
-    }
-    double eps_;
-  };
-
- protected:
-  Teuchos::RCP<FluxBCFunctor> CreateFunctor_(int f,
-          const Teuchos::Ptr<const CompositeVector>& pres);
-  int CalculateLambdaToms_(int f, const Teuchos::Ptr<const CompositeVector>& pres,
-                             double& lambda);
+  // Topology of the boundary faces, which is fixed, so it is computed once:
+  // the internal cell, and the face's index within that cell's faces.
+  void InitializeFaceGeometry_();
+
+  // Solve for the face pressure which matches the boundary flux using a
+  // bracketed Newton iteration, starting from lambda.  Returns the number
+  // of iterations, or -1 on failure.
+  int CalculateLambda_(int f, const Epetra_MultiVector& pres_c,
+                       const Epetra_MultiVector& pres_f,
+                       const Epetra_MultiVector& kr_f,
+                       const Epetra_MultiVector& rhs_f,
+                       double& lambda);
 
  protected:
   Teuchos::RCP<const State> S_next_;
@@ -122,6 +72,14 @@ class PredictorDelegateBCFlux {
   std::vector<double>* bc_values_;
   std::string uw_kr_key_;
 
+  // Per-face geometry, -1 for internal faces.  The faces of the internal
+  // cell of boundary face f are nbr_faces_[face_begin_[f]:face_begin_[f+1]].
+  std::vector<int> face_cell_;
+  std::vector<int> face_index_;
+  std::vector<int> face_begin_;
+  std::vector<int> nbr_faces_;
+
+  Teuchos::RCP<VerboseObject> vo_;
 };
 
 } // namespace
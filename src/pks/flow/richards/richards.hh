@@ -63,6 +63,11 @@ Boundary conditions:
 
 Physics control:
 
+* `"reuse diffusion residual`" ``[bool]`` **false** If pressure, density,
+  relative permeability, and boundary conditions are all unchanged since the
+  diffusion term was last evaluated, reuse it rather than reassembling the
+  operator.
+
 * `"permeability rescaling`" ``[double]`` **1** Typically 1e7 or order :math:`sqrt(K)` is about right.  This rescales things to stop from multiplying by small numbers (permeability) and then by large number (:math:`\rho / \mu`).
 
 * `"water retention evaluator`" ``[wrm-evaluator-spec]`` The WRM.  This needs to go away!
@@ -93,6 +98,7 @@ EVALUATORS:
 //#include "PK_PhysicalBDF_ATS.hh"
 // #include "pk_factory_ats.hh"
 #include "pk_physical_bdf_default.hh"
+#include "flux_reconstruction.hh"
 
 namespace Amanzi {
 
@@ -176,6 +182,7 @@ protected:
   // -- diffusion term
   virtual void ApplyDiffusion_(const Teuchos::Ptr<State>& S,
           const Teuchos::Ptr<CompositeVector>& g);
+  bool DiffusionResidualIsCurrent_(const Teuchos::Ptr<State>& S, bool update);
 
   // virtual void AddVaporDiffusionResidual_(const Teuchos::Ptr<State>& S,
   //         const Teuchos::Ptr<CompositeVector>& g);
@@ -279,6 +286,16 @@ protected:
   int jacobian_lag_;
   
 
+  // diffusion residual, and the state and BCs it was evaluated with
+  bool reuse_diffusion_res_;
+  Teuchos::RCP<CompositeVector> diffusion_res_;
+  const State* diffusion_res_S_;
+  std::vector<int> diffusion_res_markers_;
+  std::vector<double> diffusion_res_values_;
+
+  // reconstruction of the darcy velocity from fluxes
+  FluxReconstruction velocity_reconstruction_;
+
   // residual vector for vapor diffusion
   Teuchos::RCP<CompositeVector> res_vapor;
   // note PC is in PKPhysicalBDFBase
@@ -9,9 +9,6 @@
   Ethan Coon (ATS version) (ecoon@lanl.gov)
 ------------------------------------------------------------------------- */
 
-#include "Teuchos_LAPACK.hpp"
-#include "Teuchos_SerialDenseMatrix.hpp"
-
 #include "FieldEvaluator.hh"
 #include "Op.hh"
 #include "richards.hh"
@@ -27,6 +24,11 @@ void Richards::ApplyDiffusion_(const Teuchos::Ptr<State>& S,
   // update the rel perm according to the scheme of choice
   bool update = UpdatePermeabilityData_(S.ptr());
 
+  if (reuse_diffusion_res_ && DiffusionResidualIsCurrent_(S, update)) {
+    *g = *diffusion_res_;
+    return;
+  }
+
   // update the matrix
   matrix_->Init();
 
@@ -54,9 +56,45 @@ void Richards::ApplyDiffusion_(const Teuchos::Ptr<State>& S,
 
   // calculate the residual
   matrix_->ComputeNegativeResidual(*pres, *g);
+
+  if (reuse_diffusion_res_) {
+    if (diffusion_res_ == Teuchos::null)
+      diffusion_res_ = Teuchos::rcp(new CompositeVector(*g));
+    else
+      *diffusion_res_ = *g;
+  }
 };
 
 
+// -------------------------------------------------------------
+// Is the last diffusion residual valid for S?
+//
+// The residual is reevaluated without a change in pressure, e.g. by
+// coupled PKs when only the other system changed, or to check an error.
+// Its inputs are the pressure, density, and (upwinded) relative
+// permeability, whose changes are tracked under a request of our own, plus
+// the boundary conditions, which are compared directly.
+// -------------------------------------------------------------
+bool Richards::DiffusionResidualIsCurrent_(const Teuchos::Ptr<State>& S, bool update) {
+  Key request = name_ + " diffusion residual";
+
+  // every evaluator is asked, so that each request is cleared
+  bool changed = S->GetFieldEvaluator(key_)->HasFieldChanged(S, request);
+  changed |= S->GetFieldEvaluator(mass_dens_key_)->HasFieldChanged(S, request);
+  changed |= S->GetFieldEvaluator(coef_key_)->HasFieldChanged(S, request);
+  changed |= update || upwind_from_prev_flux_ || dynamic_mesh_;
+  changed |= S.get() != diffusion_res_S_;
+  changed |= bc_markers() != diffusion_res_markers_ || bc_values() != diffusion_res_values_;
+
+  if (changed) {
+    diffusion_res_S_ = S.get();
+    diffusion_res_markers_ = bc_markers();
+    diffusion_res_values_ = bc_values();
+  }
+  return !changed && diffusion_res_ != Teuchos::null;
+}
+
+
 // -------------------------------------------------------------
 // Accumulation of water term du/dt
 // -------------------------------------------------------------
@@ -172,42 +210,15 @@ Richards::UpdateVelocity_(const Teuchos::Ptr<State>& S) {
   const Epetra_MultiVector& nliq_c = *S->GetFieldData(molar_dens_key_)
       ->ViewComponent("cell",false);
   Epetra_MultiVector& velocity = *S->GetFieldData(velocity_key_, name_)
-      ->ViewComponent("cell", true);
-
-  int d(mesh_->space_dimension());
-  AmanziGeometry::Point local_velocity(d);
-
-  Teuchos::LAPACK<int, double> lapack;
-  Teuchos::SerialDenseMatrix<int, double> matrix(d, d);
-  double rhs[d];
-
-  int ncells_owned = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  AmanziMesh::Entity_ID_List faces;
-  for (int c=0; c!=ncells_owned; ++c) {
-    mesh_->cell_get_faces(c, &faces);
-    int nfaces = faces.size();
-
-    for (int i=0; i!=d; ++i) rhs[i] = 0.0;
-    matrix.putScalar(0.0);
-
-    for (int n=0; n!=nfaces; ++n) {  // populate least-square matrix
-      int f = faces[n];
-      const AmanziGeometry::Point& normal = mesh_->face_normal(f);
-      double area = mesh_->face_area(f);
-
-      for (int i=0; i!=d; ++i) {
-        rhs[i] += normal[i] * flux[0][f];
-        matrix(i, i) += normal[i] * normal[i];
-        for (int j = i+1; j < d; ++j) {
-          matrix(j, i) = matrix(i, j) += normal[i] * normal[j];
-        }
-      }
-    }
+      ->ViewComponent("cell", false);
 
-    int info;
-    lapack.POSV('U', d, 1, matrix.values(), d, rhs, d, &info);
+  // the reconstruction depends only upon the geometry
+  if (!velocity_reconstruction_.initialized() || dynamic_mesh_)
+    velocity_reconstruction_.Update(*mesh_);
+  velocity_reconstruction_.Apply(flux, velocity);
 
-    for (int i=0; i!=d; ++i) velocity[i][c] = rhs[i] / nliq_c[0][c];
+  for (int i=0; i!=velocity.NumVectors(); ++i) {
+    for (int c=0; c!=velocity.MyLength(); ++c) velocity[i][c] /= nliq_c[0][c];
   }
 }
 
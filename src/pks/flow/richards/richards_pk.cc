@@ -33,6 +33,7 @@ Authors: Neil Carlson (version 1)
 #include "OperatorDefs.hh"
 #include "BoundaryFlux.hh"
 
+#include "boundary_face_plan.hh"
 #include "richards.hh"
 
 #define DEBUG_RES_FLAG 0
@@ -61,6 +62,8 @@ Richards::Richards(Teuchos::ParameterList& pk_tree,
     upwind_from_prev_flux_(false),
     precon_wc_(false),
     dynamic_mesh_(false),
+    reuse_diffusion_res_(false),
+    diffusion_res_S_(nullptr),
     clobber_boundary_flux_dir_(false),
     vapor_diffusion_(false),
     perm_scale_(1.),
@@ -359,6 +362,7 @@ void Richards::SetupRichardsFlow_(const Teuchos::Ptr<State>& S) {
   sat_ice_change_limit_ = plist_->get<double>("max valid change in ice saturation in a time step [-]", -1.);
 
   compute_boundary_values_ = plist_->get<bool>("compute boundary values", false);
+  reuse_diffusion_res_ = plist_->get<bool>("reuse diffusion residual", false);
 
   // Require fields and evaluators for those fields.
   // -- primary variables
@@ -851,12 +855,11 @@ void Richards::UpdateBoundaryConditions_(const Teuchos::Ptr<State>& S, bool kr)
 
   auto& markers = bc_markers();
   auto& values = bc_values();
+  const BoundaryFacePlan& plan = BoundaryFacePlan::Get(mesh_);
   
   // initialize all to 0
-  for (unsigned int n=0; n!=markers.size(); ++n) {
-    markers[n] = Operators::OPERATOR_BC_NONE;
-    values[n] = 0.0;
-  }
+  std::fill(markers.begin(), markers.end(), Operators::OPERATOR_BC_NONE);
+  std::fill(values.begin(), values.end(), 0.0);
 
 
   std::vector<int> bc_counts;
@@ -1047,6 +1050,7 @@ void Richards::UpdateBoundaryConditions_(const Teuchos::Ptr<State>& S, bool kr)
   if (coupled_to_surface_via_head_) {
     // Face is Dirichlet with value of surface head
     Teuchos::RCP<const AmanziMesh::Mesh> surface = S->GetMesh("surface");
+    const AmanziMesh::Entity_ID_List& surface_faces = plan.SurfaceFaces(surface);
     const Epetra_MultiVector& head = *S->GetFieldData("surface_pressure")
         ->ViewComponent("cell",false);
 
@@ -1056,8 +1060,7 @@ void Richards::UpdateBoundaryConditions_(const Teuchos::Ptr<State>& S, bool kr)
 
     for (unsigned int c=0; c!=ncells_surface; ++c) {
       // -- get the surface cell's equivalent subsurface face
-      AmanziMesh::Entity_ID f =
-        surface->entity_get_parent(AmanziMesh::CELL, c);
+      AmanziMesh::Entity_ID f = surface_faces[c];
 
 #ifdef ENABLE_DBC
       AmanziMesh::Entity_ID_List cells;
@@ -1079,12 +1082,13 @@ void Richards::UpdateBoundaryConditions_(const Teuchos::Ptr<State>& S, bool kr)
     // Face is Neumann with value of surface residual
    
     Teuchos::RCP<const AmanziMesh::Mesh> surface = S->GetMesh(Keys::getDomain(ss_flux_key_));
+    const AmanziMesh::Entity_ID_List& surface_faces = plan.SurfaceFaces(surface);
     const Epetra_MultiVector& flux = *S->GetFieldData(ss_flux_key_)->ViewComponent("cell",false);
     unsigned int ncells_surface = flux.MyLength();
     bc_counts[bc_counts.size()-1] = ncells_surface;
     for (unsigned int c=0; c!=ncells_surface; ++c) {
       // -- get the surface cell's equivalent subsurface face
-      AmanziMesh::Entity_ID f = surface->entity_get_parent(AmanziMesh::CELL, c);
+      AmanziMesh::Entity_ID f = surface_faces[c];
 
 #ifdef ENABLE_DBC
       AmanziMesh::Entity_ID_List cells;
@@ -1107,34 +1111,7 @@ void Richards::UpdateBoundaryConditions_(const Teuchos::Ptr<State>& S, bool kr)
   }
 
   // mark all remaining boundary conditions as zero flux conditions
-  AmanziMesh::Entity_ID_List cells;
-
-  int n_default = 0;
-
-  int nfaces_owned = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
-  for (int f = 0; f < nfaces_owned; f++) {
-    if (markers[f] == Operators::OPERATOR_BC_NONE) {
-      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      int ncells = cells.size();
-
-      if (ncells == 1) {
-        n_default++;
-        markers[f] = Operators::OPERATOR_BC_NEUMANN;
-        values[f] = 0.0;
-
-        // BEGIN DEBUG CRUFT        
-        /*
-        AmanziGeometry::Point normal = mesh_->face_normal(f);
-        normal /= AmanziGeometry::norm(normal);
-        if (std::abs(normal[2]) > 0.0001) {
-          std::cout << "bottom face: " << f << std::endl;
-        }
-        */
-
-        // ENDDEBUG CRUFT        
-      }
-    }
-  }
+  int n_default = plan.MarkDefault(markers, values);
   bc_names.push_back("default (zero flux)");
   bc_counts.push_back(n_default);
 
@@ -1199,7 +1176,7 @@ bool Richards::ModifyPredictorFluxBCs_(double h, Teuchos::RCP<TreeVector> u) {
 
   if (flux_predictor_ == Teuchos::null) {
     flux_predictor_ = Teuchos::rcp(new PredictorDelegateBCFlux(S_next_, mesh_, matrix_diff_,
-            wrms_, &markers, &values, uw_coef_key_));
+            wrms_, &markers, &values, uw_coef_key_, vo_));
   }
 
   UpdatePermeabilityData_(S_next_.ptr());
@@ -1436,102 +1413,83 @@ Richards::ModifyCorrection(double h, Teuchos::RCP<const TreeVector> res,
     du->Data()->ViewComponent("boundary_face")->PutScalar(0.);
   }
 
-  // debugging -- remove me! --etc
+  // Limit in one pass, first by capping corrections when they cross
+  // atmospheric pressure (where pressure derivatives are discontinuous), then
+  // based on a max pressure change.  Norms of the correction are only
+  // computed if they will be written, and are reduced with the counts.
+  bool report = vo_->getVerbLevel() >= Teuchos::VERB_HIGH;
+  int ncomps = du->Data()->size();
+  double patm = patm_limit_ > 0. ? *S_next_->GetScalarData("atmospheric_pressure") : 0.;
+
+  // local sums: n_limited_spurt, n_limited_change, then L2^2 of the
+  // correction before and after limiting for each component
+  std::vector<double> my_sums(2 + 2*ncomps, 0.), sums(2 + 2*ncomps, 0.);
+  std::vector<double> my_maxs(2*ncomps, 0.), maxs(2*ncomps, 0.);
+
+  int i = 0;
   for (CompositeVector::name_iterator comp=du->Data()->begin();
-       comp!=du->Data()->end(); ++comp) {
+       comp!=du->Data()->end(); ++comp, ++i) {
     Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp,false);
-    double max, l2;
-    du_c.NormInf(&max);
-    du_c.Norm2(&l2);
-    if (vo_->os_OK(Teuchos::VERB_HIGH)) {
-      *vo_->os() << "Linf, L2 pressure correction (" << *comp << ") = " << max << ", " << l2 << std::endl;
-    }
-  }
-  
-  // limit by capping corrections when they cross atmospheric pressure
-  // (where pressure derivatives are discontinuous)
-  int my_limited = 0;
-  int n_limited_spurt = 0;
-  if (patm_limit_ > 0.) {
-    double patm = *S_next_->GetScalarData("atmospheric_pressure");
-    for (CompositeVector::name_iterator comp=du->Data()->begin();
-         comp!=du->Data()->end(); ++comp) {
-      Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp,false);
-      const Epetra_MultiVector& u_c = *u->Data()->ViewComponent(*comp,false);
+    const Epetra_MultiVector& u_c = *u->Data()->ViewComponent(*comp,false);
 
-      for (int c=0; c!=du_c.MyLength(); ++c) {
+    for (int c=0; c!=du_c.MyLength(); ++c) {
+      if (report) {
+        my_sums[2+2*i] += du_c[0][c] * du_c[0][c];
+        my_maxs[2*i] = std::max(my_maxs[2*i], std::abs(du_c[0][c]));
+      }
+
+      if (patm_limit_ > 0.) {
         if ((u_c[0][c] < patm) &&
             (u_c[0][c] - du_c[0][c] > patm + patm_limit_)) {
-          du_c[0][c] = u_c[0][c] - (patm + patm_limit_);          
-          my_limited++;
+          du_c[0][c] = u_c[0][c] - (patm + patm_limit_);
+          my_sums[0]++;
         } else if ((u_c[0][c] > patm) &&
                    (u_c[0][c] - du_c[0][c] < patm - patm_limit_)) {
-          du_c[0][c] = u_c[0][c] - (patm - patm_limit_);          
-          my_limited++;
+          du_c[0][c] = u_c[0][c] - (patm - patm_limit_);
+          my_sums[0]++;
         }
       }
-    }
-    mesh_->get_comm()->MaxAll(&my_limited, &n_limited_spurt, 1);
-  }
 
-  if (n_limited_spurt > 0) {
-    if (vo_->os_OK(Teuchos::VERB_HIGH)) {
-      *vo_->os() << "  limiting the spurt." << std::endl;
-    }
-  }
+      if (p_limit_ >= 0. && std::abs(du_c[0][c]) > p_limit_) {
+        du_c[0][c] = ((du_c[0][c] > 0) - (du_c[0][c] < 0)) * p_limit_;
+        my_sums[1]++;
+      }
 
-  // debugging -- remove me! --etc
-  for (CompositeVector::name_iterator comp=du->Data()->begin();
-       comp!=du->Data()->end(); ++comp) {
-    Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp,false);
-    double max, l2;
-    du_c.NormInf(&max);
-    du_c.Norm2(&l2);
-    if (vo_->os_OK(Teuchos::VERB_HIGH)) {
-      *vo_->os() << "Linf, L2 pressure correction (" << *comp << ") = " << max << ", " << l2 << std::endl;
+      if (report) {
+        my_sums[3+2*i] += du_c[0][c] * du_c[0][c];
+        my_maxs[2*i+1] = std::max(my_maxs[2*i+1], std::abs(du_c[0][c]));
+      }
     }
   }
-  
-  // Limit based on a max pressure change
-  my_limited = 0;
-  int n_limited_change = 0;
-  if (p_limit_ >= 0.) {
-    for (CompositeVector::name_iterator comp=du->Data()->begin();
-         comp!=du->Data()->end(); ++comp) {
-      Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp,false);
 
-      double max;
-      du_c.NormInf(&max);
-      if (vo_->os_OK(Teuchos::VERB_HIGH)) {
-        *vo_->os() << "Max pressure correction (" << *comp << ") = " << max << std::endl;
-      }
-      
-      for (int c=0; c!=du_c.MyLength(); ++c) {
-        if (std::abs(du_c[0][c]) > p_limit_) {
-          du_c[0][c] = ((du_c[0][c] > 0) - (du_c[0][c] < 0)) * p_limit_;
-          my_limited++;
-        }
-      }
-    }
-    
-    mesh_->get_comm()->MaxAll(&my_limited, &n_limited_change, 1);
+  // counts are only needed if a limiter is on; norms only if reported
+  if (report) {
+    mesh_->get_comm()->SumAll(my_sums.data(), sums.data(), sums.size());
+    mesh_->get_comm()->MaxAll(my_maxs.data(), maxs.data(), maxs.size());
+  } else if (patm_limit_ > 0. || p_limit_ >= 0.) {
+    mesh_->get_comm()->SumAll(my_sums.data(), sums.data(), 2);
   }
+  int n_limited_spurt = (int) sums[0];
+  int n_limited_change = (int) sums[1];
 
-  // debugging -- remove me! --etc
-  for (CompositeVector::name_iterator comp=du->Data()->begin();
-       comp!=du->Data()->end(); ++comp) {
-    Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp,false);
-    double max, l2;
-    du_c.NormInf(&max);
-    du_c.Norm2(&l2);
-    if (vo_->os_OK(Teuchos::VERB_HIGH)) {
-      *vo_->os() << "Linf, L2 pressure correction (" << *comp << ") = " << max << ", " << l2 << std::endl;
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    i = 0;
+    for (CompositeVector::name_iterator comp=du->Data()->begin();
+         comp!=du->Data()->end(); ++comp, ++i) {
+      *vo_->os() << "Linf, L2 pressure correction (" << *comp << ") = "
+                 << maxs[2*i] << ", " << std::sqrt(sums[2+2*i]) << std::endl;
     }
-  }
-  
-  if (n_limited_change > 0) {
-    if (vo_->os_OK(Teuchos::VERB_HIGH)) {
-      *vo_->os() << "  limited by pressure." << std::endl;
+    if (n_limited_spurt > 0)
+      *vo_->os() << "  limiting the spurt (" << n_limited_spurt << " entries)." << std::endl;
+    if (n_limited_change > 0)
+      *vo_->os() << "  limited by pressure (" << n_limited_change << " entries)." << std::endl;
+    if (n_limited_spurt > 0 || n_limited_change > 0) {
+      i = 0;
+      for (CompositeVector::name_iterator comp=du->Data()->begin();
+           comp!=du->Data()->end(); ++comp, ++i) {
+        *vo_->os() << "Linf, L2 limited pressure correction (" << *comp << ") = "
+                   << maxs[2*i+1] << ", " << std::sqrt(sums[3+2*i]) << std::endl;
+      }
     }
   }
 
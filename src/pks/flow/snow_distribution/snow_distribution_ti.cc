@@ -289,13 +289,18 @@ SnowDistribution::AdvanceStep(double t_old, double t_new, bool reinit) {
     
     bool failed = PK_PhysicalBDF_Default::AdvanceStep(my_t_old, my_t_new, false);
 
+    // Only fields on this PK's domain change during the distribution
+    // substeps, so only those are restored or committed, rather than
+    // copying the entire state each substep.
     if (failed) {
-      *S_next_ = *S_inter_;
+      S_next_->AssignDomain(*S_inter_, domain_);
       continue;
     }
 
     PK_PhysicalBDF_Default::CommitStep(my_t_old, my_t_new, S_next_);
-    *S_inter_ = *S_next_;
+    S_inter_->AssignDomain(*S_next_, domain_);
+    S_inter_->set_time(my_t_new);
+    S_inter_->set_last_time(my_t_old);
     my_t_old = my_t_new;
   }
   
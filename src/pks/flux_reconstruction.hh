@@ -0,0 +1,112 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! FluxReconstruction: cell vectors reconstructed from face fluxes.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*!
+
+A cell vector v is reconstructed from the fluxes through its faces as the
+least squares solution of N v = q, where the rows of N are the face normals
+of the cell and q are the face fluxes.  The operator (N^T N)^-1 N^T depends
+only on the mesh geometry, so it is computed once for each cell and stored
+contiguously, making the reconstruction a small matrix-vector product per
+cell.
+
+The operators must be recomputed by calling Update() if the mesh deforms.
+Cells whose face normals do not span the space reconstruct to zero.
+
+*/
+
+#ifndef ATS_FLUX_RECONSTRUCTION_HH_
+#define ATS_FLUX_RECONSTRUCTION_HH_
+
+#include <algorithm>
+#include <vector>
+
+#include "Epetra_MultiVector.h"
+#include "Teuchos_LAPACK.hpp"
+
+#include "dbc.hh"
+#include "Mesh.hh"
+
+namespace Amanzi {
+
+class FluxReconstruction {
+
+ public:
+  FluxReconstruction() : d_(0) {}
+
+  // Compute the operators of the owned cells of mesh.
+  void Update(const AmanziMesh::Mesh& mesh)
+  {
+    d_ = mesh.space_dimension();
+    AMANZI_ASSERT(d_ <= 3);
+    int ncells_owned = mesh.num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+    offsets_.resize(ncells_owned + 1);
+    offsets_[0] = 0;
+    faces_.clear();
+    coefs_.clear();
+
+    Teuchos::LAPACK<int, double> lapack;
+    std::vector<double> matrix(d_*d_);
+    AmanziMesh::Entity_ID_List faces;
+    for (int c=0; c!=ncells_owned; ++c) {
+      mesh.cell_get_faces(c, &faces);
+      int nfaces = faces.size();
+      offsets_[c+1] = offsets_[c] + nfaces;
+      faces_.insert(faces_.end(), faces.begin(), faces.end());
+
+      // least squares matrix N^T N, and N^T as the right hand sides
+      std::fill(matrix.begin(), matrix.end(), 0.);
+      coefs_.resize(d_ * offsets_[c+1]);
+      double* op = &coefs_[d_ * offsets_[c]];
+      for (int n=0; n!=nfaces; ++n) {
+        const AmanziGeometry::Point& normal = mesh.face_normal(faces[n]);
+        for (int i=0; i!=d_; ++i) {
+          op[i + d_*n] = normal[i];
+          for (int j=i; j!=d_; ++j) matrix[i + d_*j] += normal[i] * normal[j];
+        }
+      }
+
+      // a degenerate cell reconstructs to zero
+      int info;
+      lapack.POSV('U', d_, nfaces, matrix.data(), d_, op, d_, &info);
+      if (info != 0) std::fill(op, op + d_*nfaces, 0.);
+    }
+  }
+
+  bool initialized() const { return d_ > 0; }
+
+  // Reconstruct owned cell vectors from (ghosted) face fluxes.
+  void Apply(const Epetra_MultiVector& flux, Epetra_MultiVector& v) const
+  {
+    AMANZI_ASSERT(v.NumVectors() == d_);
+    int ncells = offsets_.size() - 1;
+    const double* q = flux[0];
+    for (int c=0; c!=ncells; ++c) {
+      double vc[3] = { 0., 0., 0. };
+      const double* op = &coefs_[d_ * offsets_[c]];
+      for (int n=offsets_[c]; n!=offsets_[c+1]; ++n, op += d_) {
+        double qf = q[faces_[n]];
+        for (int i=0; i!=d_; ++i) vc[i] += op[i] * qf;
+      }
+      for (int i=0; i!=d_; ++i) v[i][c] = vc[i];
+    }
+  }
+
+ private:
+  int d_;
+  std::vector<int> offsets_;
+  std::vector<AmanziMesh::Entity_ID> faces_;
+  std::vector<double> coefs_;  // d x nfaces, column-major, per cell
+};
+
+} // namespace Amanzi
+
+#endif
@@ -271,15 +271,9 @@ MPCCoupledWater::ModifyCorrection(double h, Teuchos::RCP<const TreeVector> res,
     StrongMPC<PK_PhysicalBDF_Default>::ModifyCorrection(h, res, u, du);
   
   // modify correction using water approaches
-  int n_modified = 0;
-  n_modified += water_->ModifyCorrection_WaterFaceLimiter(h, res, u, du);
-  double damping = water_->ModifyCorrection_WaterSpurtDamp(h, res, u, du);
-  n_modified += water_->ModifyCorrection_WaterSpurtCap(h, res, u, du, damping);
-
-  // -- accumulate globally
-  int n_modified_l = n_modified;
-  u->SubVector(0)->Data()->Comm().SumAll(&n_modified_l, &n_modified, 1);
-  bool modified = (n_modified > 0) || (damping < 1.);
+  // -- the face limiter is local, and is accumulated globally with the spurt
+  int n_modified = water_->ModifyCorrection_WaterFaceLimiter(h, res, u, du);
+  bool modified = water_->ModifyCorrection_WaterSpurt(h, res, u, du, n_modified);
 
   // -- calculate consistent subsurface cells
   if (modified) {
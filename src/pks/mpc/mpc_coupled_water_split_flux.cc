@@ -32,6 +32,15 @@ MPCCoupledWaterSplitFlux::MPCCoupledWaterSplitFlux(Teuchos::ParameterList& FElis
   lateral_flow_source_ = Keys::readKey(*plist_, domain, "lateral flow source", "lateral_flow_source");
   conserved_variable_star_ = Keys::readKey(*plist_, domain_star, "conserved quantity star", "water_content");
   cv_key_ = Keys::readKey(*plist_, domain, "cell volume", "cell_volume");
+
+  subcycle_primary_ = plist_->get<bool>("subcycle primary on failure", false);
+  max_primary_failures_ = plist_->get<int>("maximum primary subcycle failures", 10);
+  primary_subcycled_ = false;
+  if (plist_->isParameter("primary domain names")) {
+    primary_domains_ = plist_->get<Teuchos::Array<std::string> >("primary domain names").toVector();
+  } else {
+    primary_domains_ = SurfaceSubsurfaceDomains(domain);
+  }
   
   // set up for a primary variable field evaluator for the flux
   auto& sublist = S->FEList().sublist(lateral_flow_source_);
@@ -94,7 +103,29 @@ bool MPCCoupledWaterSplitFlux::AdvanceStep(double t_old, double t_new, bool rein
   CopyStarToPrimary(t_new - t_old);
 
   // Now advance the primary
+  primary_subcycled_ = false;
   fail = sub_pks_[1]->AdvanceStep(t_old, t_new, reinit);
+  if (fail && subcycle_primary_) {
+    // Keep the star solution and its lateral flux source, which is the
+    // mean rate over the step, and take smaller steps in the primary only.
+    if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
+      Teuchos::OSTab tab = vo_->getOSTab();
+      *vo_->os() << "Primary failed, subcycling it across the star step." << std::endl;
+    }
+    if (S_primary_save_ == Teuchos::null) {
+      S_primary_save_ = Teuchos::rcp(new State(*S_inter_));
+    } else {
+      for (const auto& domain : primary_domains_) S_primary_save_->AssignDomain(*S_inter_, domain);
+    }
+
+    // the source lives on a primary domain, so must survive restores
+    *S_inter_->GetFieldData(lateral_flow_source_, S_inter_->GetField(lateral_flow_source_)->owner()) =
+        *S_next_->GetFieldData(lateral_flow_source_);
+
+    fail = SubcycleDomains(*sub_pks_[1], t_old, t_new, max_primary_failures_,
+                           primary_domains_, S_inter_.ptr(), S_next_, *S_primary_save_, *vo_);
+    primary_subcycled_ = !fail;
+  }
   return fail;
 };
 
@@ -102,8 +133,12 @@ bool MPCCoupledWaterSplitFlux::AdvanceStep(double t_old, double t_new, bool rein
 void MPCCoupledWaterSplitFlux::CommitStep(double t_old, double t_new,
         const Teuchos::RCP<State>& S) {
   // commit before copy to ensure record for extrapolation in star system uses
-  // its own solutions
-  MPC<PK>::CommitStep(t_old, t_new, S);
+  // its own solutions; a subcycled primary committed each of its steps
+  if (primary_subcycled_) {
+    sub_pks_[0]->CommitStep(t_old, t_new, S);
+  } else {
+    MPC<PK>::CommitStep(t_old, t_new, S);
+  }
 
   // Copy the primary into the star to advance
   CopyPrimaryToStar(S.ptr(), S.ptr());
@@ -1,5 +1,6 @@
 // Delegate for heuristic corrections based upon coupled surface/subsurface water.
 
+#include "boundary_face_plan.hh"
 #include "mpc_delegate_water.hh"
 
 namespace Amanzi {
@@ -78,78 +79,49 @@ MPCDelegateWater::ModifyCorrection_WaterFaceLimiter(double h, Teuchos::RCP<const
 //  using a global damping term.
 // Approach 3: capping of the spurt -- limit the max oversaturated pressure
 //  if coming from undersaturated.
-double
-MPCDelegateWater::ModifyCorrection_WaterSpurtDamp(double h, Teuchos::RCP<const TreeVector> res,
-        Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu) {
-  const double& patm = *S_next_->GetScalarData("atmospheric_pressure");
-
-  Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh =
-      u->SubVector(i_surf_)->Data()->Mesh();
-  int ncells_surf = surf_mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-
-  const Epetra_MultiVector& domain_p_f = *u->SubVector(i_domain_)->Data()
-      ->ViewComponent("face",false);
+//
+// Both are decided from the same pass over surface faces.  Capping is
+// independent of the damping, as a capped correction replaces the damped
+// one, so caps are found locally and applied after the damping.  The damping
+// and the modified counts, including n_modified already made locally by the
+// caller, are then reduced together.
+bool
+MPCDelegateWater::ModifyCorrection_WaterSpurt(double h, Teuchos::RCP<const TreeVector> res,
+        Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu, int n_modified) {
   Teuchos::RCP<CompositeVector> domain_Pu = Pu->SubVector(i_domain_)->Data();
   Epetra_MultiVector& domain_Pu_f = *domain_Pu->ViewComponent("face",false);
 
-  // Approach 2
   double damp = 1.;
-  if (damp_the_spurt_) {
-    for (int cs=0; cs!=ncells_surf; ++cs) {
-      AmanziMesh::Entity_ID f =
-          surf_mesh->entity_get_parent(AmanziMesh::CELL, cs);
-      double p_old = domain_p_f[0][f];
-      double p_new = p_old - domain_Pu_f[0][f];
-      if ((p_new > patm + cap_size_) && (p_old < patm)) {
-        double my_damp = ((patm + cap_size_) - p_old) / (p_new - p_old);
-        damp = std::min(damp, my_damp);
-        if (vo_->os_OK(Teuchos::VERB_EXTREME))
-          std::cout << "   DAMPING THE SPURT (sc=" << surf_mesh->cell_map(false).GID(cs) << "): p_old = " << p_old << ", p_new = " << p_new << ", coef = " << my_damp << std::endl;
-      }
-    }
-
-    double proc_damp = damp;
-    domain_Pu_f.Comm().MinAll(&proc_damp, &damp, 1);
-    if (damp < 1.0) {
-      if (vo_->os_OK(Teuchos::VERB_HIGH))
-        *vo_->os() << "  DAMPING THE SPURT!, coef = " << damp << std::endl;
-      domain_Pu->Scale(damp);
-    }
-  }
-  return damp;
-}
-
-
-int
-MPCDelegateWater::ModifyCorrection_WaterSpurtCap(double h, Teuchos::RCP<const TreeVector> res,
-        Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu, double damp) {
-  const double& patm = *S_next_->GetScalarData("atmospheric_pressure");
-
-  Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh =
-      u->SubVector(i_surf_)->Data()->Mesh();
-  int ncells_surf = surf_mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-
-  const Epetra_MultiVector& domain_p_f = *u->SubVector(i_domain_)->Data()
-      ->ViewComponent("face",false);
-  Teuchos::RCP<CompositeVector> domain_Pu = Pu->SubVector(i_domain_)->Data();
-  Epetra_MultiVector& domain_Pu_f = *domain_Pu->ViewComponent("face",false);
-
-  // Approach 3
-  int n_modified = 0;
-  if (cap_the_spurt_) {
-    for (int cs=0; cs!=ncells_surf; ++cs) {
-      AmanziMesh::Entity_ID f = surf_mesh->entity_get_parent(AmanziMesh::CELL, cs);
+  caps_.clear();
+  if (damp_the_spurt_ || cap_the_spurt_) {
+    const double& patm = *S_next_->GetScalarData("atmospheric_pressure");
+    Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh =
+        u->SubVector(i_surf_)->Data()->Mesh();
+    const Epetra_MultiVector& domain_p_f = *u->SubVector(i_domain_)->Data()
+        ->ViewComponent("face",false);
+    const AmanziMesh::Entity_ID_List& surf_faces =
+        BoundaryFacePlan::Get(domain_Pu->Mesh()).SurfaceFaces(surf_mesh);
 
+    for (int cs=0; cs!=surf_faces.size(); ++cs) {
+      AmanziMesh::Entity_ID f = surf_faces[cs];
       double p_old = domain_p_f[0][f];
-      double p_new = p_old - domain_Pu_f[0][f] / damp;
+      double p_new = p_old - domain_Pu_f[0][f];
       if ((p_new > patm + cap_size_) && (p_old < patm)) {
-        domain_Pu_f[0][f] = p_old - (patm + cap_size_);
-        n_modified++;
-        if (vo_->os_OK(Teuchos::VERB_HIGH))
-          std::cout << "  CAPPING THE SPURT (sc=" << surf_mesh->cell_map(false).GID(cs) << ",f=" 
-		    << u->SubVector(i_domain_)->Data()->Mesh()->face_map(false).GID(f) << "): p_old = " << p_old
-                    << ", p_new = " << p_new << ", p_capped = " << p_old - domain_Pu_f[0][f] << std::endl;
-      } else if ((p_new < patm) && (p_old > patm)) {
+        if (damp_the_spurt_) {
+          double my_damp = ((patm + cap_size_) - p_old) / (p_new - p_old);
+          damp = std::min(damp, my_damp);
+          if (vo_->os_OK(Teuchos::VERB_EXTREME))
+            std::cout << "   DAMPING THE SPURT (sc=" << surf_mesh->cell_map(false).GID(cs) << "): p_old = " << p_old << ", p_new = " << p_new << ", coef = " << my_damp << std::endl;
+        }
+        if (cap_the_spurt_) {
+          caps_.emplace_back(f, p_old - (patm + cap_size_));
+          n_modified++;
+          if (vo_->os_OK(Teuchos::VERB_HIGH))
+            std::cout << "  CAPPING THE SPURT (sc=" << surf_mesh->cell_map(false).GID(cs) << ",f="
+                      << domain_Pu->Mesh()->face_map(false).GID(f) << "): p_old = " << p_old
+                      << ", p_new = " << p_new << ", p_capped = " << patm + cap_size_ << std::endl;
+        }
+      } else if (cap_the_spurt_ && (p_new < patm) && (p_old > patm)) {
         // strange attempt to kick NKA when it goes back under?
         n_modified++;
         if (vo_->os_OK(Teuchos::VERB_HIGH))
@@ -159,86 +131,76 @@ MPCDelegateWater::ModifyCorrection_WaterSpurtCap(double h, Teuchos::RCP<const Tr
     }
   }
 
-  return n_modified;
-}
-
+  if (!ReduceModified_(domain_Pu_f.Comm(), damp, n_modified)) return false;
 
-// Approach 2: damping of the spurt -- limit the max oversaturated pressure
-//  using a global damping term.
-// Approach 3: capping of the spurt -- limit the max oversaturated pressure
-//  if coming from undersaturated.
-double
-MPCDelegateWater::ModifyCorrection_SaturatedSpurtDamp(double h, Teuchos::RCP<const TreeVector> res,
-        Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu) {
-  const double& patm = *S_next_->GetScalarData("atmospheric_pressure");
+  if (damp < 1.0) {
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "  DAMPING THE SPURT!, coef = " << damp << std::endl;
+    domain_Pu->Scale(damp);
+  }
+  for (const auto& cap : caps_) domain_Pu_f[0][cap.first] = cap.second;
+  return true;
+}
 
-  Teuchos::RCP<const AmanziMesh::Mesh> domain_mesh =
-      u->SubVector(i_domain_)->Data()->Mesh();
-  int ncells_domain = domain_mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
 
-  const Epetra_MultiVector& domain_p_c = *u->SubVector(i_domain_)->Data()
-      ->ViewComponent("cell",false);
+// As above, for subsurface cells.
+bool
+MPCDelegateWater::ModifyCorrection_SaturatedSpurt(double h, Teuchos::RCP<const TreeVector> res,
+        Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu, int n_modified) {
   Teuchos::RCP<CompositeVector> domain_Pu = Pu->SubVector(i_domain_)->Data();
   Epetra_MultiVector& domain_Pu_c = *domain_Pu->ViewComponent("cell",false);
 
-  // Approach 2
   double damp = 1.;
-  if (damp_the_sat_spurt_) {
-    for (int c=0; c!=ncells_domain; ++c) {
+  caps_.clear();
+  if (damp_the_sat_spurt_ || cap_the_sat_spurt_) {
+    const double& patm = *S_next_->GetScalarData("atmospheric_pressure");
+    Teuchos::RCP<const AmanziMesh::Mesh> domain_mesh = domain_Pu->Mesh();
+    const Epetra_MultiVector& domain_p_c = *u->SubVector(i_domain_)->Data()
+        ->ViewComponent("cell",false);
+
+    for (int c=0; c!=domain_Pu_c.MyLength(); ++c) {
       double p_old = domain_p_c[0][c];
       double p_new = p_old - domain_Pu_c[0][c];
       if ((p_new > patm + cap_size_) && (p_old < patm)) {
-        double my_damp = ((patm + cap_size_) - p_old) / (p_new - p_old);
-        damp = std::min(damp, my_damp);
-        if (vo_->os_OK(Teuchos::VERB_EXTREME))
-          std::cout << "   DAMPING THE SATURATED SPURT (c=" << domain_mesh->cell_map(false).GID(c) << "): p_old = " << p_old << ", p_new = " << p_new << ", coef = " << my_damp << std::endl;
+        if (damp_the_sat_spurt_) {
+          double my_damp = ((patm + cap_size_) - p_old) / (p_new - p_old);
+          damp = std::min(damp, my_damp);
+          if (vo_->os_OK(Teuchos::VERB_EXTREME))
+            std::cout << "   DAMPING THE SATURATED SPURT (c=" << domain_mesh->cell_map(false).GID(c) << "): p_old = " << p_old << ", p_new = " << p_new << ", coef = " << my_damp << std::endl;
+        }
+        if (cap_the_sat_spurt_) {
+          caps_.emplace_back(c, p_old - (patm + cap_size_));
+          n_modified++;
+          if (vo_->os_OK(Teuchos::VERB_HIGH))
+            std::cout << "  CAPPING THE SATURATED SPURT (c=" << domain_mesh->cell_map(false).GID(c)
+                      << "): p_old = " << p_old
+                      << ", p_new = " << p_new << ", p_capped = " << patm + cap_size_ << std::endl;
+        }
       }
     }
-
-    double proc_damp = damp;
-    domain_Pu_c.Comm().MinAll(&proc_damp, &damp, 1);
-    if (damp < 1.0) {
-      if (vo_->os_OK(Teuchos::VERB_HIGH))
-        *vo_->os() << "  DAMPING THE SATURATED SPURT!, coef = " << damp << std::endl;
-      domain_Pu->Scale(damp);
-    }
   }
-  return damp;
-}
-
 
-int
-MPCDelegateWater::ModifyCorrection_SaturatedSpurtCap(double h, Teuchos::RCP<const TreeVector> res,
-        Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu, double damp) {
-  const double& patm = *S_next_->GetScalarData("atmospheric_pressure");
+  if (!ReduceModified_(domain_Pu_c.Comm(), damp, n_modified)) return false;
 
-  Teuchos::RCP<const AmanziMesh::Mesh> domain_mesh =
-      u->SubVector(i_domain_)->Data()->Mesh();
-  int ncells_domain = domain_mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-
-  const Epetra_MultiVector& domain_p_c = *u->SubVector(i_domain_)->Data()
-      ->ViewComponent("cell",false);
-  Teuchos::RCP<CompositeVector> domain_Pu = Pu->SubVector(i_domain_)->Data();
-  Epetra_MultiVector& domain_Pu_c = *domain_Pu->ViewComponent("cell",false);
-
-  // Approach 3
-  int n_modified = 0;
-  if (cap_the_sat_spurt_) {
-    for (int c=0; c!=ncells_domain; ++c) {
-      double p_old = domain_p_c[0][c];
-      double p_new = p_old - domain_Pu_c[0][c] / damp;
-      if ((p_new > patm + cap_size_) && (p_old < patm)) {
-        domain_Pu_c[0][c] = p_old - (patm + cap_size_);
-        n_modified++;
-        if (vo_->os_OK(Teuchos::VERB_HIGH))
-          std::cout << "  CAPPING THE SATURATED SPURT (c=" << domain_mesh->cell_map(false).GID(c)
-                    << "): p_old = " << p_old
-                    << ", p_new = " << p_new << ", p_capped = " << p_old - domain_Pu_c[0][c] << std::endl;
-      }
-    }
+  if (damp < 1.0) {
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "  DAMPING THE SATURATED SPURT!, coef = " << damp << std::endl;
+    domain_Pu->Scale(damp);
   }
+  for (const auto& cap : caps_) domain_Pu_c[0][cap.first] = cap.second;
+  return true;
+}
 
-  return n_modified;
+
+// One reduction for both the global damping (a min) and whether anything was
+// modified (a max), returning the latter.
+bool
+MPCDelegateWater::ReduceModified_(const Epetra_Comm& comm, double& damp, int n_modified) {
+  double my_vals[2] = { -damp, (double) n_modified };
+  double vals[2];
+  comm.MaxAll(my_vals, vals, 2);
+  damp = -vals[0];
+  return (vals[1] > 0.) || (damp < 1.);
 }
 
 // modify predictor via heuristic stops spurting in the surface flow
@@ -14,6 +14,7 @@
 
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_ParameterList.hpp"
+#include "Epetra_Comm.h"
 
 #include "VerboseObject.hh"
 #include "Debugger.hh"
@@ -120,21 +121,19 @@ class MPCDelegateWater {
   ModifyCorrection_WaterFaceLimiter(double h, Teuchos::RCP<const TreeVector> res,
           Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> du);
 
-  double
-  ModifyCorrection_WaterSpurtDamp(double h, Teuchos::RCP<const TreeVector> res,
-          Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> du);
-
-  int
-  ModifyCorrection_WaterSpurtCap(double h, Teuchos::RCP<const TreeVector> res,
-                                    Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> du, double damping);
+  // Damps and/or caps the spurt, returning true if the correction was
+  // modified on any process, by this or by the n_modified local
+  // modifications already made.  Collective, with a single reduction.
+  bool
+  ModifyCorrection_WaterSpurt(double h, Teuchos::RCP<const TreeVector> res,
+          Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> du, int n_modified=0);
 
-  double
-  ModifyCorrection_SaturatedSpurtDamp(double h, Teuchos::RCP<const TreeVector> res,
-          Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> du);
+  bool
+  ModifyCorrection_SaturatedSpurt(double h, Teuchos::RCP<const TreeVector> res,
+          Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> du, int n_modified=0);
 
-  int
-  ModifyCorrection_SaturatedSpurtCap(double h, Teuchos::RCP<const TreeVector> res,
-                                    Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> du, double damping);
+ protected:
+  bool ReduceModified_(const Epetra_Comm& comm, double& damp, int n_modified);
 
  protected:
   Teuchos::RCP<Teuchos::ParameterList> plist_;
@@ -162,6 +161,9 @@ class MPCDelegateWater {
   double cap_size_;
   double face_limiter_;
 
+  // -- work space: local entities capped and their capped corrections
+  std::vector<std::pair<int,double> > caps_;
+
   // indices into the TreeVector
   int i_surf_;
   int i_domain_;
@@ -560,23 +560,13 @@ MPCPermafrost4::ModifyCorrection(double h, Teuchos::RCP<const TreeVector> r,
   }
     
   // modify correction using water approaches
-  int n_modified = 0;
-  double damping = 1;
+  // -- the surface damping sees the saturated-damped correction, so these
+  //    are reduced separately
+  bool modified = false;
   if (water_.get()) {
-    damping = water_->ModifyCorrection_SaturatedSpurtDamp(h, r, u, du);
-    n_modified += water_->ModifyCorrection_SaturatedSpurtCap(h, r, u, du, damping);
-
-    double damping_surf = water_->ModifyCorrection_WaterSpurtDamp(h, r, u, du);
-    n_modified += water_->ModifyCorrection_WaterSpurtCap(h, r, u, du, damping_surf);
-
-    // -- total damping
-    damping = damping * damping_surf;
-  
-    // -- accumulate globally
-    int n_modified_l = n_modified;
-    u->SubVector(0)->Data()->Comm().SumAll(&n_modified_l, &n_modified, 1);
+    modified = water_->ModifyCorrection_SaturatedSpurt(h, r, u, du);
+    modified |= water_->ModifyCorrection_WaterSpurt(h, r, u, du);
   }
-  bool modified = (n_modified > 0) || (damping < 1.);
 
   if (modified) {
     // Copy subsurface face corrections to surface cell corrections
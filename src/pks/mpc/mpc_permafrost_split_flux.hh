@@ -34,6 +34,15 @@ dE / dt = div (  Kappa grad T) + hq )
 Kappa grad T |_s = qE_ss
 
 
+If the primary system fails, by default the whole step fails, and the star
+system is solved again at the smaller step.  With "subcycle primary on
+failure" true, the star solution and lateral flux source are kept instead,
+and only the primary is subcycled across the star step, with the source
+(the star's mean rate over the step) held fixed.  The step fails only if the
+primary fails "maximum primary subcycle failures" [int] (10) times.  Fields
+on the "primary domain names" [Array(string)], by default the subsurface,
+surface, and snow domains, are restored between substeps.
+
 ------------------------------------------------------------------------- */
 
 #ifndef PKS_MPC_PERMAFROST_SPLIT_FLUX_HH_
@@ -89,6 +98,13 @@ class MPCPermafrostSplitFlux : public MPC<PK> {
   Key T_lateral_flow_source_;
   
   Key cv_key_;
+
+  // subcycling of the primary system over the star step, on failure
+  bool subcycle_primary_;
+  bool primary_subcycled_;
+  int max_primary_failures_;
+  std::vector<Key> primary_domains_;
+  Teuchos::RCP<State> S_primary_save_;
   Teuchos::RCP<PrimaryVariableFieldEvaluator> p_eval_pvfe_;
   Teuchos::RCP<PrimaryVariableFieldEvaluator> T_eval_pvfe_;
   
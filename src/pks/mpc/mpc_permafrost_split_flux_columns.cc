@@ -62,6 +62,10 @@ MPCPermafrostSplitFluxColumns::MPCPermafrostSplitFluxColumns(Teuchos::ParameterL
     col_domains_.push_back(domain_name_stream.str());
   }
 
+  // -- moving fields between the star system and the columns
+  surf_columns_ = &Relations::ColumnScatter::Get(surf_mesh, domain_surf);
+  columns_ = &Relations::ColumnScatter::Get(surf_mesh, domain_col);
+
   // set up keys
   p_primary_variable_suffix_ = plist_->get<std::string>("pressure primary variable suffix", "pressure");
   T_primary_variable_suffix_ = plist_->get<std::string>("temperature primary variable suffix", "temperature");
@@ -216,15 +220,9 @@ MPCPermafrostSplitFluxColumns::CopyPrimaryToStar(const Teuchos::Ptr<const State>
   // copy p primary variables into star primary variable
   auto& p_star = *S_star->GetFieldData(p_primary_variable_star_, S_star->GetField(p_primary_variable_star_)->owner())
                   ->ViewComponent("cell",false);
+  surf_columns_->Gather(*S, p_primary_variable_suffix_, p_star);
   for (int c=0; c!=p_star.MyLength(); ++c) {
-    Key pkey = Keys::getKey("surface_"+col_domains_[c], p_primary_variable_suffix_);
-    const auto& p = *S->GetFieldData(pkey)->ViewComponent("cell",false);
-    AMANZI_ASSERT(p.MyLength() == 1);
-    if (p[0][0] <= 101325.0) {
-      p_star[0][c] = 101325.;
-    } else {
-      p_star[0][c] = p[0][0];
-    }
+    if (p_star[0][c] <= 101325.0) p_star[0][c] = 101325.;
   }
 
   auto peval = S_star->GetFieldEvaluator(p_primary_variable_star_);
@@ -234,12 +232,7 @@ MPCPermafrostSplitFluxColumns::CopyPrimaryToStar(const Teuchos::Ptr<const State>
   // copy T primary variable
   auto& T_star = *S_star->GetFieldData(T_primary_variable_star_, S_star->GetField(T_primary_variable_star_)->owner())
                   ->ViewComponent("cell",false);
-  for (int c=0; c!=p_star.MyLength(); ++c) {
-    Key Tkey = Keys::getKey("surface_"+col_domains_[c], T_primary_variable_suffix_);
-    const auto& T = *S->GetFieldData(Tkey)->ViewComponent("cell",false);
-    AMANZI_ASSERT(T.MyLength() == 1);
-    T_star[0][c] = T[0][0];
-  }
+  surf_columns_->Gather(*S, T_primary_variable_suffix_, T_star);
 
   auto Teval = S_star->GetFieldEvaluator(T_primary_variable_star_);
   auto Teval_pvfe = Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(Teval);
@@ -266,7 +259,7 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryPressure_(double dt)
                        ->ViewComponent("cell",false);
   for (int c=0; c!=p_star.MyLength(); ++c) {
     if (p_star[0][c] > 101325.0000001) {
-      Key pkey = Keys::getKey("surface_"+col_domains_[c], p_primary_variable_suffix_);
+      Key pkey = surf_columns_->key(c, p_primary_variable_suffix_);
       auto& p = *S_inter_->GetFieldData(pkey, S_inter_->GetField(pkey)->owner())->ViewComponent("cell",false);
       AMANZI_ASSERT(p.MyLength() == 1);
       p[0][0] = p_star[0][c];
@@ -277,8 +270,8 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryPressure_(double dt)
       eval_pv->SetFieldAsChanged(S_inter_.ptr());
 
       CopySurfaceToSubsurface(*S_inter_->GetFieldData(pkey),
-              S_inter_->GetFieldData(Keys::getKey(col_domains_[c], p_primary_variable_suffix_),
-                      S_inter_->GetField(Keys::getKey(col_domains_[c], p_primary_variable_suffix_))->owner()).ptr());
+              S_inter_->GetFieldData(columns_->key(c, p_primary_variable_suffix_),
+                      S_inter_->GetField(columns_->key(c, p_primary_variable_suffix_))->owner()).ptr());
     }
   }
 
@@ -286,7 +279,7 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryPressure_(double dt)
   const auto& T_star = *S_next_->GetFieldData(T_primary_variable_star_)
                        ->ViewComponent("cell",false);
   for (int c=0; c!=T_star.MyLength(); ++c) {
-    Key Tkey = Keys::getKey("surface_"+col_domains_[c], T_primary_variable_suffix_);
+    Key Tkey = surf_columns_->key(c, T_primary_variable_suffix_);
     auto& T = *S_inter_->GetFieldData(Tkey, S_inter_->GetField(Tkey)->owner())->ViewComponent("cell",false);
     AMANZI_ASSERT(T.MyLength() == 1);
     T[0][0] = T_star[0][c];
@@ -297,8 +290,8 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryPressure_(double dt)
     eval_pv->SetFieldAsChanged(S_inter_.ptr());
     
     CopySurfaceToSubsurface(*S_inter_->GetFieldData(Tkey),
-                            S_inter_->GetFieldData(Keys::getKey(col_domains_[c], T_primary_variable_suffix_),
-                                    S_inter_->GetField(Keys::getKey(col_domains_[c], T_primary_variable_suffix_))->owner()).ptr());
+                            S_inter_->GetFieldData(columns_->key(c, T_primary_variable_suffix_),
+                                    S_inter_->GetField(columns_->key(c, T_primary_variable_suffix_))->owner()).ptr());
   }
 }
 
@@ -366,12 +359,12 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryHybrid_(double dt)
   for (int c=0; c!=p_star.MyLength(); ++c) {
     if (p_star[0][c] > 101325. && q_div[0][c] < 0.) {
       // use the Dirichlet
-      Key pkey = Keys::getKey("surface_"+col_domains_[c], p_primary_variable_suffix_);
+      Key pkey = surf_columns_->key(c, p_primary_variable_suffix_);
       auto& p = *S_inter_->GetFieldData(pkey, S_inter_->GetField(pkey)->owner())->ViewComponent("cell",false);
       AMANZI_ASSERT(p.MyLength() == 1);
       p[0][0] = p_star[0][c];
 
-      Key Tkey = Keys::getKey("surface_"+col_domains_[c], T_primary_variable_suffix_);
+      Key Tkey = surf_columns_->key(c, T_primary_variable_suffix_);
       auto& T = *S_inter_->GetFieldData(Tkey, S_inter_->GetField(Tkey)->owner())->ViewComponent("cell",false);
       AMANZI_ASSERT(T.MyLength() == 1);
       T[0][0] = T_star[0][c];
@@ -389,28 +382,28 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryHybrid_(double dt)
 
       // copy from surface to subsurface to ensure consistency
       CopySurfaceToSubsurface(*S_inter_->GetFieldData(pkey),
-                              S_inter_->GetFieldData(Keys::getKey(col_domains_[c], p_primary_variable_suffix_),
-                                                     S_inter_->GetField(Keys::getKey(col_domains_[c], p_primary_variable_suffix_))->owner()).ptr());
+                              S_inter_->GetFieldData(columns_->key(c, p_primary_variable_suffix_),
+                                                     S_inter_->GetField(columns_->key(c, p_primary_variable_suffix_))->owner()).ptr());
       CopySurfaceToSubsurface(*S_inter_->GetFieldData(Tkey),
-                              S_inter_->GetFieldData(Keys::getKey(col_domains_[c], T_primary_variable_suffix_),
-                                                     S_inter_->GetField(Keys::getKey(col_domains_[c], T_primary_variable_suffix_))->owner()).ptr());
+                              S_inter_->GetFieldData(columns_->key(c, T_primary_variable_suffix_),
+                                                     S_inter_->GetField(columns_->key(c, T_primary_variable_suffix_))->owner()).ptr());
 
       // set the lateral flux to 0
-      Key p_lf_key = Keys::getKey("surface_"+col_domains_[c], p_lateral_flow_source_suffix_);
+      Key p_lf_key = surf_columns_->key(c, p_lateral_flow_source_suffix_);
       (*S_next_->GetFieldData(p_lf_key, p_lf_key)->ViewComponent("cell",false))[0][0] = 0.;
       p_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
 
-      Key T_lf_key = Keys::getKey("surface_"+col_domains_[c], T_lateral_flow_source_suffix_);
+      Key T_lf_key = surf_columns_->key(c, T_lateral_flow_source_suffix_);
       (*S_next_->GetFieldData(T_lf_key, T_lf_key)->ViewComponent("cell",false))[0][0] = 0.;
       T_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
 
     } else { 
       // use flux
-      Key p_lf_key = Keys::getKey("surface_"+col_domains_[c], p_lateral_flow_source_suffix_);
+      Key p_lf_key = surf_columns_->key(c, p_lateral_flow_source_suffix_);
       (*S_next_->GetFieldData(p_lf_key, p_lf_key)->ViewComponent("cell",false))[0][0] = q_div[0][c];
       p_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
 
-      Key T_lf_key = Keys::getKey("surface_"+col_domains_[c], T_lateral_flow_source_suffix_);
+      Key T_lf_key = surf_columns_->key(c, T_lateral_flow_source_suffix_);
       (*S_next_->GetFieldData(T_lf_key, T_lf_key)->ViewComponent("cell",false))[0][0] = qE_div[0][c];
       T_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
     }
@@ -460,11 +453,8 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryFlux_(double dt)
   q_div.ReciprocalMultiply(1.0, *S_next_->GetFieldData(cv_key_)->ViewComponent("cell",false), q_div, 0.);
 
   // copy into columns
-  for (int c=0; c!=q_div.MyLength(); ++c) {
-    Key pkey = Keys::getKey("surface_"+col_domains_[c], p_lateral_flow_source_suffix_);
-    (*S_next_->GetFieldData(pkey, pkey)->ViewComponent("cell",false))[0][0] = q_div[0][c];
-    p_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
-  }
+  surf_columns_->Scatter(q_div, *S_next_, p_lateral_flow_source_suffix_);
+  for (const auto& eval : p_eval_pvfes_) eval->SetFieldAsChanged(S_next_.ptr());
   
   // grab the data, difference
   Epetra_MultiVector qE_div(*S_next_->GetFieldData(T_conserved_variable_star_)->ViewComponent("cell",false));
@@ -478,11 +468,8 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryFlux_(double dt)
   qE_div.ReciprocalMultiply(1.0, *S_next_->GetFieldData(cv_key_)->ViewComponent("cell",false), qE_div, 0.);
 
   // copy into columns
-  for (int c=0; c!=qE_div.MyLength(); ++c) {
-    Key Tkey = Keys::getKey("surface_"+col_domains_[c], T_lateral_flow_source_suffix_);
-    (*S_next_->GetFieldData(Tkey, Tkey)->ViewComponent("cell",false))[0][0] = qE_div[0][c];
-    T_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
-  }
+  surf_columns_->Scatter(qE_div, *S_next_, T_lateral_flow_source_suffix_);
+  for (const auto& eval : T_eval_pvfes_) eval->SetFieldAsChanged(S_next_.ptr());
 }
 
 // protected constructor of subpks
@@ -42,6 +42,7 @@ Kappa grad T |_s = qE_ss
 #include "PK.hh"
 #include "mpc.hh"
 #include "primary_variable_field_evaluator.hh"
+#include "ColumnScatter.hh"
 
 namespace Amanzi {
 
@@ -103,6 +104,8 @@ class MPCPermafrostSplitFluxColumns : public MPC<PK> {
   std::vector<Teuchos::RCP<PrimaryVariableFieldEvaluator> > p_eval_pvfes_;
   std::vector<Teuchos::RCP<PrimaryVariableFieldEvaluator> > T_eval_pvfes_;
   std::vector<std::string> col_domains_;
+  const Relations::ColumnScatter* surf_columns_;
+  const Relations::ColumnScatter* columns_;
 
   std::string coupling_;
   
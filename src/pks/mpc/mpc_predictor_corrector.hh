@@ -178,7 +178,7 @@ bool MPCPredictorCorrector<PK_t>::AdvanceStep(double t_old, double t_new, bool r
     else pred_fail_gi_good_++;
   } else {
     if (fail) pred_good_gi_fail_++;
-    else if (this->time_stepper_->number_nonlinear_steps() == 0) pred_good_gi_itr0_++;
+    else if (this->NumberNonlinearSteps_() == 0) pred_good_gi_itr0_++;
     else pred_good_gi_itrN_++;
   }
 
@@ -55,4 +55,85 @@ MergeSubsurfaceAndSurfacePressure(const CompositeVector& h_prev,
 }
 
 
+std::vector<Key>
+SurfaceSubsurfaceDomains(const Key& surface_domain)
+{
+  std::vector<Key> domains;
+  if (surface_domain == "surface") {
+    domains.push_back("domain");
+    domains.push_back("surface");
+    domains.push_back("snow");
+  } else if (surface_domain.compare(0, 8, "surface_") == 0) {
+    Key col = surface_domain.substr(8);
+    domains.push_back(col);
+    domains.push_back(surface_domain);
+    domains.push_back("snow_"+col);
+  } else {
+    domains.push_back(surface_domain);
+  }
+  return domains;
+}
+
+
+bool
+SubcycleDomains(PK& pk, double t_old, double t_new, int max_failures,
+                const std::vector<Key>& domains,
+                const Teuchos::Ptr<State>& S_inter,
+                const Teuchos::RCP<State>& S_next,
+                const State& S_save,
+                VerboseObject& vo)
+{
+  Teuchos::OSTab tab = vo.getOSTab();
+  double t_inner = t_old;
+  int nfailures = 0;
+  int nsteps = 0;
+
+  // each attempt starts from S_inter at t_inner
+  for (const auto& domain : domains) S_next->AssignDomain(*S_inter, domain);
+  S_inter->set_time(t_old);
+
+  while (t_inner < t_new - 1.e-10) {
+    double dt_inner = std::min(pk.get_dt(), t_new - t_inner);
+    *S_next->GetScalarData("dt", "coordinator") = dt_inner;
+    S_next->set_time(t_inner + dt_inner);
+
+    bool fail = pk.AdvanceStep(t_inner, t_inner + dt_inner, false);
+    fail |= !pk.ValidStep();
+
+    if (fail) {
+      // the PK has already cut its dt
+      for (const auto& domain : domains) S_next->AssignDomain(*S_inter, domain);
+      if (vo.os_OK(Teuchos::VERB_HIGH))
+        *vo.os() << "  substep [" << t_inner << ", " << t_inner + dt_inner << "] failed" << std::endl;
+
+      if (++nfailures > max_failures) {
+        for (const auto& domain : domains) {
+          S_inter->AssignDomain(S_save, domain);
+          S_next->AssignDomain(S_save, domain);
+        }
+        S_inter->set_time(t_old);
+        S_next->set_time(t_new);
+        *S_next->GetScalarData("dt", "coordinator") = t_new - t_old;
+        return true;
+      }
+    } else {
+      pk.CommitStep(t_inner, t_inner + dt_inner, S_next);
+      t_inner += dt_inner;
+      nsteps++;
+      for (const auto& domain : domains) S_inter->AssignDomain(*S_next, domain);
+      S_inter->set_time(t_inner);
+    }
+  }
+
+  if (vo.os_OK(Teuchos::VERB_MEDIUM))
+    *vo.os() << "  subcycled " << nsteps << " steps with " << nfailures << " failures" << std::endl;
+
+  // restore the old time level, so that a failure elsewhere can be retried
+  for (const auto& domain : domains) S_inter->AssignDomain(S_save, domain);
+  S_inter->set_time(t_old);
+  *S_next->GetScalarData("dt", "coordinator") = t_new - t_old;
+  return false;
+}
+
+
 } // namespace
@@ -1,7 +1,12 @@
 #ifndef PKS_MPC_SURFACE_SUBSURFACE_HELPERS_HH_
 #define PKS_MPC_SURFACE_SUBSURFACE_HELPERS_HH_
 
+#include <vector>
+
 #include "CompositeVector.hh"
+#include "State.hh"
+#include "VerboseObject.hh"
+#include "PK.hh"
 
 namespace Amanzi {
 
@@ -18,6 +23,28 @@ MergeSubsurfaceAndSurfacePressure(const CompositeVector& kr_surf,
 				  const Teuchos::Ptr<CompositeVector>& sub_p,
 				  const Teuchos::Ptr<CompositeVector>& surf_p);
 
+// Domains of a surface-subsurface system, given its surface domain:
+// "surface" --> {"domain", "surface", "snow"}, "surface_column_3" -->
+// {"column_3", "surface_column_3", "snow_column_3"}.
+std::vector<Key>
+SurfaceSubsurfaceDomains(const Key& surface_domain);
+
+// Advance a PK over [t_old, t_new] in steps of its own choosing, retrying
+// failed steps.  Only the fields on the given domains are restored or
+// committed between steps, so anything else the PK reads (e.g. a source
+// from an operator-split partner) is held fixed over the interval.
+//
+// S_save must hold those domains at t_old on entry; S_inter is returned
+// with them at t_old.  On failure, after max_failures failed steps, S_next
+// is also returned with them at t_old.
+bool
+SubcycleDomains(PK& pk, double t_old, double t_new, int max_failures,
+                const std::vector<Key>& domains,
+                const Teuchos::Ptr<State>& S_inter,
+                const Teuchos::RCP<State>& S_next,
+                const State& S_save,
+                VerboseObject& vo);
+
 
 } // namespace
 
@@ -22,6 +22,7 @@ See additional documentation in the base class src/pks/mpc/MPC.hh
 
 #include "mpc.hh"
 #include "pk_bdf_default.hh"
+#include "pk_timers.hh"
 
 namespace Amanzi {
 
@@ -99,6 +100,11 @@ protected:
   using MPC<PK_t>::pk_tree_;
   using MPC<PK_t>::pks_list_;
 
+  // per sub-PK timers
+  std::vector<Teuchos::RCP<Teuchos::Time> > residual_timers_;
+  std::vector<Teuchos::RCP<Teuchos::Time> > apply_pc_timers_;
+  std::vector<Teuchos::RCP<Teuchos::Time> > update_pc_timers_;
+
 private:
   // factory registration
   static RegisteredPKFactory<StrongMPC> reg_;
@@ -117,6 +123,12 @@ StrongMPC<PK_t>::StrongMPC(Teuchos::ParameterList& pk_tree,
     MPC<PK_t>(pk_tree, global_list, S, soln),
     PK_BDF_Default(pk_tree, global_list, S, soln) {
   MPC<PK_t>::init_(S);
+
+  for (const auto& pk : sub_pks_) {
+    residual_timers_.push_back(PKTimer(pk->name(), "FunctionalResidual"));
+    apply_pc_timers_.push_back(PKTimer(pk->name(), "ApplyPreconditioner"));
+    update_pc_timers_.push_back(PKTimer(pk->name(), "UpdatePreconditioner"));
+  }
 }
 
 
@@ -211,6 +223,7 @@ void StrongMPC<PK_t>::FunctionalResidual(double t_old, double t_new, Teuchos::RC
     }
 
     // fill the nonlinear function with each sub-PKs contribution
+    Teuchos::TimeMonitor timer(*residual_timers_[i]);
     sub_pks_[i]->FunctionalResidual(t_old, t_new, pk_u_old, pk_u_new, pk_g);
   }
 };
@@ -239,6 +252,7 @@ int StrongMPC<PK_t>::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuch
     }
 
     // Fill the preconditioned u as the block-diagonal product using each sub-PK.
+    Teuchos::TimeMonitor timer(*apply_pc_timers_[i]);
     int icur_err = sub_pks_[i]->ApplyPreconditioner(pk_u, pk_Pu);
     ierr += icur_err;
   }
@@ -301,6 +315,7 @@ void StrongMPC<PK_t>::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVect
     }
 
     // update precons of each of the sub-PKs
+    Teuchos::TimeMonitor timer(*update_pc_timers_[i]);
     sub_pks_[i]->UpdatePreconditioner(t, pk_up, h);
   };
 };
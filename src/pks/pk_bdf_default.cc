@@ -11,7 +11,9 @@ BDF.
 ------------------------------------------------------------------------- */
 
 #include "Teuchos_TimeMonitor.hpp"
+#include "errors.hh"
 #include "BDF1_TI.hh"
+#include "pk_timers.hh"
 #include "pk_bdf_default.hh"
 #include "State.hh"
 
@@ -51,7 +53,23 @@ void PK_BDF_Default::Initialize(const Teuchos::Ptr<State>& S) {
     bdf_plist.set("initial time", S->time());
     if (!bdf_plist.isSublist("verbose object"))
       bdf_plist.set("verbose object", plist_->sublist("verbose object"));
-    time_stepper_ = Teuchos::rcp(new BDF1_TI<TreeVector,TreeVectorSpace>(*this, bdf_plist, solution_));
+
+    if (bdf_plist.get<bool>("truncation error control", false)) {
+      lte_controller_ = Teuchos::rcp(new TimestepControllerLTE(
+          bdf_plist.sublist("truncation error control parameters"), *solution_));
+    }
+
+    std::string method = bdf_plist.get<std::string>("time integration method", "BDF1");
+    if (method == "BDF1 JFNK") {
+      jfnk_stepper_ = Teuchos::rcp(new BDF1_JFNK(*this, bdf_plist, solution_));
+    } else if (method == "BDF1") {
+      time_stepper_ = Teuchos::rcp(new BDF1_TI<TreeVector,TreeVectorSpace>(*this, bdf_plist, solution_));
+    } else {
+      Errors::Message msg;
+      msg << "PK \"" << name_ << "\": unknown time integration method \"" << method
+          << "\", valid are \"BDF1\" and \"BDF1 JFNK\".";
+      Exceptions::amanzi_throw(msg);
+    }
 
     // initialize continuation parameter if needed.
     if (bdf_plist.isSublist("continuation parameters")) {
@@ -59,12 +77,14 @@ void PK_BDF_Default::Initialize(const Teuchos::Ptr<State>& S) {
       S->GetField("continuation_parameter", name_)->set_initialized();
     }
 
-    // -- initialize time derivative
-    Teuchos::RCP<TreeVector> solution_dot = Teuchos::rcp(new TreeVector(*solution_));
-    solution_dot->PutScalar(0.0);
+    if (time_stepper_ != Teuchos::null) {
+      // -- initialize time derivative
+      Teuchos::RCP<TreeVector> solution_dot = Teuchos::rcp(new TreeVector(*solution_));
+      solution_dot->PutScalar(0.0);
 
-    // -- set initial state
-    time_stepper_->SetInitialState(S->time(), solution_, solution_dot);
+      // -- set initial state
+      time_stepper_->SetInitialState(S->time(), solution_, solution_dot);
+    }
   }
 
 };
@@ -84,6 +104,10 @@ void PK_BDF_Default::CommitStep(double t_old, double t_new, const Teuchos::RCP<S
   double dt = t_new -t_old;
   if (dt > 0. && time_stepper_ != Teuchos::null)
     time_stepper_->CommitSolution(dt, solution_, true);
+  if (dt > 0. && jfnk_stepper_ != Teuchos::null)
+    jfnk_stepper_->CommitSolution(dt);
+  if (dt > 0. && lte_controller_ != Teuchos::null)
+    lte_controller_->CommitStep(dt);
 }
 
 void PK_BDF_Default::set_states(const Teuchos::RCP<const State>& S,
@@ -119,6 +143,7 @@ bool PK_BDF_Default::AdvanceStep(double t_old, double t_new, bool reinit) {
                << "----------------------------------------------------------------" << std::endl;
 
   State_to_Solution(S_next_, *solution_);
+  if (lte_controller_ != Teuchos::null) lte_controller_->StartStep(*solution_);
 
   // take a bdf timestep
   double dt_solver;
@@ -126,7 +151,31 @@ bool PK_BDF_Default::AdvanceStep(double t_old, double t_new, bool reinit) {
   if (true) { // this is here simply to create a context for timer,
               // which stops the clock when it is destroyed at the
               // closing brace.
-    fail = time_stepper_->TimeStep(dt, dt_solver, solution_);
+    if (step_walltime_ == Teuchos::null) step_walltime_ = PKTimer(name_, "AdvanceStep");
+    Teuchos::TimeMonitor timer(*step_walltime_);
+    if (jfnk_stepper_ != Teuchos::null) {
+      fail = jfnk_stepper_->TimeStep(t_old, dt, dt_solver);
+    } else {
+      fail = time_stepper_->TimeStep(dt, dt_solver, solution_);
+    }
+  }
+
+  if (!fail && lte_controller_ != Teuchos::null) {
+    // Choose the timestep from the truncation error, limited by the nonlinear
+    // solver's recommendation if it is struggling.
+    bool reject = false;
+    double dt_lte = lte_controller_->EstimateTimestep(dt, *solution_, reject);
+    if (dt_lte > 0.) {
+      if (vo_->os_OK(Teuchos::VERB_MEDIUM))
+        *vo_->os() << "truncation error estimate = " << lte_controller_->error()
+                   << ", recommended dt = " << dt_lte << std::endl;
+      dt_solver = dt_solver < dt ? std::min(dt_lte, dt_solver) : dt_lte;
+      if (reject) {
+        if (vo_->os_OK(Teuchos::VERB_LOW))
+          *vo_->os() << "truncation error too large, rejecting step" << std::endl;
+        fail = true;
+      }
+    }
   }
 
   if (!fail) {
@@ -146,7 +195,10 @@ bool PK_BDF_Default::AdvanceStep(double t_old, double t_new, bool reinit) {
     } else {
       if (vo_->os_OK(Teuchos::VERB_LOW))
         *vo_->os() << "successful advance, but not valid" << std::endl;
-      time_stepper_->CommitSolution(dt_, solution_, valid);
+      if (time_stepper_ != Teuchos::null)
+        time_stepper_->CommitSolution(dt_, solution_, valid);
+      if (jfnk_stepper_ != Teuchos::null)
+        jfnk_stepper_->ResetHistory();
       dt_ = 0.5*dt_;
     }
   } else {
@@ -160,6 +212,12 @@ bool PK_BDF_Default::AdvanceStep(double t_old, double t_new, bool reinit) {
 };
 
 
+int PK_BDF_Default::NumberNonlinearSteps_() const {
+  if (jfnk_stepper_ != Teuchos::null) return jfnk_stepper_->number_nonlinear_steps();
+  return time_stepper_->number_nonlinear_steps();
+}
+
+
 // update the continuation parameter
 void PK_BDF_Default::UpdateContinuationParameter(double lambda) {
   *S_next_->GetScalarData("continuation_parameter", name_) = lambda;
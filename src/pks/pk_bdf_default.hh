@@ -36,6 +36,15 @@ couples the flow and energy PKs, not to the flow or energy PK itself.
   A TimeIntegrator_.  Note that this is only provided if this PK is not
   strongly coupled to other PKs.
 
+  * `"time integration method`" ``[string]`` **BDF1** One of `"BDF1`", which
+    uses the Amanzi BDF1 integrator and its nonlinear solvers, or `"BDF1
+    JFNK`", which uses an inexact Jacobian-free Newton-Krylov solve, see
+    ``BDF1_JFNK``.
+
+  * `"truncation error control`" ``[bool]`` **false** If true, choose the
+    timestep from an estimate of the local truncation error, see
+    ``TimestepControllerLTE``.
+
 * `"preconditioner`" ``[preconditioner-typed-spec]`` **optional** is a Preconditioner_ spec.
   Note that this is only used if this PK is not strongly coupled to other PKs.
 
@@ -55,6 +64,9 @@ NOTE: ``PKBDFBase  (v)-->`` PKDefaultBase_
 #include "BDF1_TI.hh"
 #include "PK_BDF.hh"
 
+#include "bdf1_jfnk.hh"
+#include "timestep_controller_lte.hh"
+
 
 
 namespace Amanzi {
@@ -127,6 +139,9 @@ class PK_BDF_Default : public PK_BDF {
   virtual void ChangedSolution() = 0;
   virtual void ChangedSolution(const Teuchos::Ptr<State>& S) = 0;
 
+ protected:
+  // number of nonlinear iterations in the last step, from either integrator
+  int NumberNonlinearSteps_() const;
  
  protected: // data
   // preconditioner assembly control
@@ -135,6 +150,8 @@ class PK_BDF_Default : public PK_BDF {
   // timestep control
   double dt_;
   Teuchos::RCP<BDF1_TI<TreeVector, TreeVectorSpace> > time_stepper_;
+  Teuchos::RCP<BDF1_JFNK> jfnk_stepper_;
+  Teuchos::RCP<TimestepControllerLTE> lte_controller_;
 
   // timing
   Teuchos::RCP<Teuchos::Time> step_walltime_;
@@ -14,6 +14,7 @@ Explicit.
 #include "PK.hh"
 #include "State.hh"
 #include "boost/algorithm/string.hpp"
+#include "pk_timers.hh"
 #include "pk_explicit_default.hh"
 
 namespace Amanzi {
@@ -110,6 +111,8 @@ bool PK_Explicit_Default::AdvanceStep(double t_old, double t_new, bool reinit) {
   if (true) { // this is here simply to create a context for timer,
               // which stops the clock when it is destroyed at the
               // closing brace.
+    if (step_walltime_ == Teuchos::null) step_walltime_ = PKTimer(name_, "AdvanceStep");
+    Teuchos::TimeMonitor timer(*step_walltime_);
     time_stepper_->TimeStep(S_inter_->time(), dt, *solution_old_, *solution_);
   }
   return false;
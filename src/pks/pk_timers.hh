@@ -0,0 +1,53 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! Named Teuchos timers for PK methods.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*!
+
+PK methods are timed with Teuchos timers named `"PK: NAME: METHOD`", which
+appear in the timer summary at the end of a run and in the profile report (see
+ProfileReport_).  PKs on domain sets, e.g. one per column, share a timer per
+set, so a PK named `"flow_column_12`" is timed as `"flow_column_*`".
+
+*/
+
+#ifndef ATS_PK_TIMERS_HH_
+#define ATS_PK_TIMERS_HH_
+
+#include <cctype>
+#include <string>
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_TimeMonitor.hpp"
+
+namespace Amanzi {
+
+inline Teuchos::RCP<Teuchos::Time>
+PKTimer(const std::string& pk_name, const std::string& method)
+{
+  // collapse domain set indices, "_12" --> "_*"
+  std::string name;
+  for (std::size_t i=0; i!=pk_name.size(); ++i) {
+    name.push_back(pk_name[i]);
+    if (pk_name[i] == '_' && i+1 < pk_name.size() && std::isdigit(pk_name[i+1])) {
+      std::size_t j = i+1;
+      while (j < pk_name.size() && std::isdigit(pk_name[j])) ++j;
+      if (j == pk_name.size() || !std::isalpha(pk_name[j])) {
+        name.push_back('*');
+        i = j-1;
+      }
+    }
+  }
+  return Teuchos::TimeMonitor::getNewCounter("PK: " + name + ": " + method);
+}
+
+} // namespace Amanzi
+
+#endif
@@ -0,0 +1,102 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! RegionEntityCache: memoized region-to-entity lists.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*!
+
+Mesh::get_set_entities() resolves a region to its entities from scratch on
+every call, which for geometric regions means a geometric query over every
+entity of the mesh.  Evaluators which loop over regions in every evaluation
+instead look up the list here, which resolves each (mesh, region, kind,
+parallel type) once.
+
+Lists hold their mesh weakly, so a list is rebuilt, rather than reused, if
+its mesh was freed and another allocated at the same address.
+
+Labeled sets never change, but membership in geometric regions does change
+as a mesh deforms.  Amanzi meshes carry no version number, so meshes must be
+deformed through DeformMeshAndCaches(), which drops that mesh's lists,
+rather than by calling Mesh::deform() directly.
+
+*/
+
+#ifndef ATS_REGION_ENTITY_CACHE_HH_
+#define ATS_REGION_ENTITY_CACHE_HH_
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "Teuchos_RCP.hpp"
+
+#include "Mesh.hh"
+
+namespace Amanzi {
+
+class RegionEntityCache {
+
+ public:
+  static const AmanziMesh::Entity_ID_List&
+  Get(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh, const std::string& region,
+      AmanziMesh::Entity_kind kind, AmanziMesh::Parallel_type ptype)
+  {
+    auto& lists = Lists_();
+    auto key = std::make_tuple(mesh.get(), region, (int) kind, (int) ptype);
+    auto entry = lists.find(key);
+    if (entry != lists.end() && !entry->second.first.shares_resource(mesh)) {
+      lists.erase(entry);
+      entry = lists.end();
+    }
+    if (entry == lists.end()) {
+      entry = lists.emplace(key, std::make_pair(mesh.create_weak(), AmanziMesh::Entity_ID_List())).first;
+      mesh->get_set_entities(region, kind, ptype, &entry->second.second);
+    }
+    return entry->second.second;
+  }
+
+  // Drop all lists of a mesh whose geometry has changed.
+  static void MeshChanged(const AmanziMesh::Mesh& mesh)
+  {
+    auto& lists = Lists_();
+    for (auto entry = lists.begin(); entry != lists.end(); ) {
+      if (std::get<0>(entry->first) == &mesh) {
+        entry = lists.erase(entry);
+      } else {
+        ++entry;
+      }
+    }
+  }
+
+ private:
+  typedef std::tuple<const AmanziMesh::Mesh*, std::string, int, int> Key_;
+  typedef std::pair<Teuchos::RCP<const AmanziMesh::Mesh>, AmanziMesh::Entity_ID_List> Entry_;
+
+  static std::map<Key_, Entry_>& Lists_()
+  {
+    static std::map<Key_, Entry_> lists;
+    return lists;
+  }
+};
+
+
+// Deform a mesh, as Mesh::deform(), and drop its cached region lists.
+template<typename... Args>
+auto DeformMeshAndCaches(AmanziMesh::Mesh& mesh, Args&&... args)
+    -> decltype(mesh.deform(std::forward<Args>(args)...))
+{
+  auto ierr = mesh.deform(std::forward<Args>(args)...);
+  RegionEntityCache::MeshChanged(mesh);
+  return ierr;
+}
+
+} // namespace Amanzi
+
+#endif
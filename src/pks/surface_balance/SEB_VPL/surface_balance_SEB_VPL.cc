@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------- */
 
 
+#include "boundary_face_plan.hh"
 #include "surface_top_cells_evaluator.hh"
 
 #include "surface_balance_SEB_VPL.hh"
@@ -366,16 +367,16 @@ void SurfaceBalanceSEBVPL::Initialize(const Teuchos::Ptr<State>& S) {
 
   // loop over all cells and call CalculateSEB_
   int ncells = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  // the top cell of each surface cell
+  const AmanziMesh::Entity_ID_List& top_cells =
+      BoundaryFacePlan::Get(subsurf_mesh_).Surface(mesh_).cells;
   for (int c=0; c!=ncells; ++c) {
     // ATS Calcualted Data
     double density_air = 1.275;       // Density of Air ------------------- [kg/m^3]
     data.st_energy.water_depth = ponded_depth[0][c]; 
     
-    AmanziMesh::Entity_ID subsurf_f = mesh_->entity_get_parent(AmanziMesh::CELL, c);
-    AmanziMesh::Entity_ID_List cells;
-    subsurf_mesh_->face_get_cells(subsurf_f, AmanziMesh::Parallel_type::OWNED, &cells);
-    AMANZI_ASSERT(cells.size() == 1);
-    data.st_energy.saturation_liquid = saturation_liquid[0][cells[0]];
+    AmanziMesh::Entity_ID top_c = top_cells[c];
+    data.st_energy.saturation_liquid = saturation_liquid[0][top_c];
 
     data.st_energy.surface_pressure = surface_pressure[0][c];
     //data.st_energy.stored_pressure = surface_pressure[0][c];
@@ -422,11 +423,7 @@ void SurfaceBalanceSEBVPL::Initialize(const Teuchos::Ptr<State>& S) {
       // ATS Calcualted Data
       data_bare.st_energy.water_depth = ponded_depth[0][c];
 
-    AmanziMesh::Entity_ID subsurf_f = mesh_->entity_get_parent(AmanziMesh::CELL, c);
-    AmanziMesh::Entity_ID_List cells;
-    subsurf_mesh_->face_get_cells(subsurf_f, AmanziMesh::Parallel_type::OWNED, &cells);
-    AMANZI_ASSERT(cells.size() == 1);
-      data_bare.st_energy.saturation_liquid = saturation_liquid[0][cells[0]];  
+      data_bare.st_energy.saturation_liquid = saturation_liquid[0][top_c];  
 
       data_bare.st_energy.surface_pressure = surface_pressure[0][c];
       data_bare.st_energy.stored_surface_pressure = stored_surface_pressure[0][c];
@@ -494,9 +491,9 @@ void SurfaceBalanceSEBVPL::Initialize(const Teuchos::Ptr<State>& S) {
   //  AMANZI_ASSERT(cells.size() == 1);
     // surface mass sources are in m^3 water / (m^2 s)
     // subsurface mass sources are in mol water / (m^3 s)
-    surface_vapor_flux[0][cells[0]] = data.st_energy.SurfaceVaporFlux 
+    surface_vapor_flux[0][top_c] = data.st_energy.SurfaceVaporFlux 
       * mesh_->cell_volume(c) * data.st_energy.density_w / 0.0180153
-      / subsurf_mesh_->cell_volume(cells[0]);
+      / subsurf_mesh_->cell_volume(top_c);
 
     // STUFF SnowEnergyBalance NEEDS STORED FOR NEXT TIME STEP
     snow_depth[0][c] = data.st_energy.ht_snow;
@@ -5,6 +5,7 @@
   Authors: Ethan Coon (ecoon@lanl.gov)
 */
 
+#include "boundary_face_plan.hh"
 #include "Debugger.hh"
 #include "surface_balance_evaluator_VPL.hh"
 #include "SnowEnergyBalance_VPL.hh"
@@ -134,16 +135,16 @@ SurfaceBalanceEvaluatorVPL::EvaluateField_(const Teuchos::Ptr<State>& S,
     }
 
   int count = Qe.MyLength();
+  // the top cell of each surface cell
+  const AmanziMesh::Entity_ID_List& top_cells =
+      BoundaryFacePlan::Get(subsurf_mesh_).Surface(mesh_).cells;
   for (unsigned int c=0; c!=count; ++c) {
     // ATS Calcualted Data
     double density_air = 1.275; // [kg/m^3]
     data.st_energy.water_depth = ponded_depth[0][c];
 
-   AmanziMesh::Entity_ID subsurf_f = mesh_->entity_get_parent(AmanziMesh::CELL, c);
-   AmanziMesh::Entity_ID_List cells;
-   subsurf_mesh_->face_get_cells(subsurf_f, AmanziMesh::Parallel_type::OWNED, &cells);
-   AMANZI_ASSERT(cells.size() == 1);
-    data.st_energy.saturation_liquid = saturation_liquid[0][cells[0]];
+   AmanziMesh::Entity_ID top_c = top_cells[c];
+    data.st_energy.saturation_liquid = saturation_liquid[0][top_c];
    
     data.st_energy.surface_pressure = surface_pressure[0][c];
     data.st_energy.stored_surface_pressure = stored_surface_pressure[0][c];
@@ -207,11 +208,7 @@ SurfaceBalanceEvaluatorVPL::EvaluateField_(const Teuchos::Ptr<State>& S,
       // ATS Calcualted Data
       data_bare.st_energy.water_depth = ponded_depth[0][c];
      
-    AmanziMesh::Entity_ID subsurf_f = mesh_->entity_get_parent(AmanziMesh::CELL, c);
-    AmanziMesh::Entity_ID_List cells;
-    subsurf_mesh_->face_get_cells(subsurf_f, AmanziMesh::Parallel_type::OWNED, &cells);
-    AMANZI_ASSERT(cells.size() == 1); 
-      data_bare.st_energy.saturation_liquid = saturation_liquid[0][cells[0]];
+      data_bare.st_energy.saturation_liquid = saturation_liquid[0][top_c];
     
       data_bare.st_energy.surface_pressure = surface_pressure[0][c];
       data_bare.st_energy.stored_surface_pressure = stored_surface_pressure[0][c];
@@ -366,15 +363,15 @@ void SurfaceBalanceEvaluatorVPL::EvaluateFieldPartialDerivative_(
     }
 
   int count = dQe.MyLength();
+  // the top cell of each surface cell
+  const AmanziMesh::Entity_ID_List& top_cells =
+      BoundaryFacePlan::Get(subsurf_mesh_).Surface(mesh_).cells;
   for (unsigned int c=0; c!=count; ++c) {
     // ATS Calcualted Data
     double density_air = 1.275; // [kg/m^3]
     data.st_energy.water_depth = ponded_depth[0][c];
-  AmanziMesh::Entity_ID subsurf_f = mesh_->entity_get_parent(AmanziMesh::CELL, c);
-  AmanziMesh::Entity_ID_List cells;
-  subsurf_mesh_->face_get_cells(subsurf_f, AmanziMesh::Parallel_type::OWNED, &cells);
-  AMANZI_ASSERT(cells.size() == 1);
-    data.st_energy.saturation_liquid = saturation_liquid[0][cells[0]];
+  AmanziMesh::Entity_ID top_c = top_cells[c];
+    data.st_energy.saturation_liquid = saturation_liquid[0][top_c];
     data.st_energy.surface_pressure = surface_pressure[0][c];
     data.st_energy.stored_surface_pressure = stored_surface_pressure[0][c];
     //data.st_energy.stored_fQe = stored_Qe[0][c];
@@ -424,11 +421,7 @@ void SurfaceBalanceEvaluatorVPL::EvaluateFieldPartialDerivative_(
       // Calculate as if bare ground
       // ATS Calcualted Data
       data_bare.st_energy.water_depth = ponded_depth[0][c];
-    AmanziMesh::Entity_ID subsurf_f = mesh_->entity_get_parent(AmanziMesh::CELL, c);
-    AmanziMesh::Entity_ID_List cells;
-    subsurf_mesh_->face_get_cells(subsurf_f, AmanziMesh::Parallel_type::OWNED, &cells);
-    AMANZI_ASSERT(cells.size() == 1);
-      data_bare.st_energy.saturation_liquid = saturation_liquid[0][cells[0]]; 
+      data_bare.st_energy.saturation_liquid = saturation_liquid[0][top_c]; 
       data_bare.st_energy.surface_pressure = surface_pressure[0][c];
       data_bare.st_energy.stored_surface_pressure = stored_surface_pressure[0][c];
       //data_bare.st_energy.stored_fQe = stored_Qe[0][c];
@@ -13,7 +13,12 @@ Author: Ethan Coon (coonet @ ornl.gov)
 /*!
 
 
-* 
+* `"meteorological data`" ``[list]`` **optional** If given, the incoming
+  radiation, air temperature, relative humidity, wind speed and
+  precipitation are read from this HDF5 time series file, each from the
+  dataset named by its variable, e.g. `"air_temperature`", unless its
+  evaluator is already listed.  Holds the parameters of a `"time series`"
+  evaluator other than `"value header`".
 
 */
 
@@ -28,6 +28,8 @@ respectively.
 
 #include "boost/algorithm/string/predicate.hpp"
 
+#include "boundary_face_plan.hh"
+#include "TimeSeriesEvaluator.hh"
 #include "VerboseObject.hh"
 #include "seb_subgrid_evaluator.hh"
 #include "seb_physics_defs.hh"
@@ -238,12 +240,12 @@ SubgridEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   }
   
   unsigned int ncells = mass_source.MyLength();
+  // the top cell of each surface cell
+  const AmanziMesh::Entity_ID_List& top_cells =
+      BoundaryFacePlan::Get(S->GetMesh(domain_ss_)).Surface(S->GetMesh(domain_)).cells;
   for (unsigned int c=0; c!=ncells; ++c) {
     // get the top cell
-    AmanziMesh::Entity_ID subsurf_f = mesh.entity_get_parent(AmanziMesh::CELL, c);
-    AmanziMesh::Entity_ID_List cells;
-    mesh_ss.face_get_cells(subsurf_f, AmanziMesh::Parallel_type::OWNED, &cells);
-    AMANZI_ASSERT(cells.size() == 1);
+    AmanziMesh::Entity_ID top_c = top_cells[c];
 
     // met data structure
     SEBPhysics::MetData met;
@@ -273,13 +275,13 @@ SubgridEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
           surf.ponded_depth = ponded_depth[0][c];
         } else {
           double factor = std::max(ponded_depth[0][c],0.)/params.water_ground_transition_depth;
-          surf.porosity = 1. * factor + poro[0][cells[0]] * (1-factor);
-          surf.saturation_gas = (1-factor) * sat_gas[0][cells[0]];
+          surf.porosity = 1. * factor + poro[0][top_c] * (1-factor);
+          surf.saturation_gas = (1-factor) * sat_gas[0][top_c];
           surf.ponded_depth = ponded_depth[0][c];
         }
       } else {
-        surf.porosity = poro[0][cells[0]];
-        surf.saturation_gas = sat_gas[0][cells[0]];
+        surf.porosity = poro[0][top_c];
+        surf.saturation_gas = sat_gas[0][top_c];
         surf.ponded_depth = 0.;
       }
       surf.unfrozen_fraction = unfrozen_fraction[0][c];
@@ -303,9 +305,9 @@ SubgridEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
       mass_source[0][c] += area_fracs[0][c] * flux.M_surf;
       energy_source[0][c] += area_fracs[0][c] * flux.E_surf * 1.e-6; // convert to MW/m^2
 
-      double area_to_volume = mesh.cell_volume(c) / mesh_ss.cell_volume(cells[0]);
-      ss_mass_source[0][cells[0]] += area_fracs[0][c] * flux.M_subsurf * area_to_volume * params.density_water / 0.0180153; // convert from m/m^2/s to mol/m^3/s
-      ss_energy_source[0][cells[0]] += area_fracs[0][c] * flux.E_subsurf * area_to_volume * 1.e-6; // convert from W/m^2 to MW/m^3
+      double area_to_volume = mesh.cell_volume(c) / mesh_ss.cell_volume(top_c);
+      ss_mass_source[0][top_c] += area_fracs[0][c] * flux.M_subsurf * area_to_volume * params.density_water / 0.0180153; // convert from m/m^2/s to mol/m^3/s
+      ss_energy_source[0][top_c] += area_fracs[0][c] * flux.E_subsurf * area_to_volume * 1.e-6; // convert from W/m^2 to MW/m^3
 
       snow_source[0][c] += area_fracs[0][c] * flux.M_snow;
       new_snow[0][c] += area_fracs[0][c] * met.Ps;
@@ -343,8 +345,8 @@ SubgridEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
         surf.saturation_gas = 0.;
       } else {
         double factor = std::max(ponded_depth[0][c],0.)/params.water_ground_transition_depth;
-        surf.porosity = 1. * factor + poro[0][cells[0]] * (1-factor);
-        surf.saturation_gas = (1-factor) * sat_gas[0][cells[0]];
+        surf.porosity = 1. * factor + poro[0][top_c] * (1-factor);
+        surf.saturation_gas = (1-factor) * sat_gas[0][top_c];
       }
       surf.ponded_depth = ponded_depth[0][c];
       surf.unfrozen_fraction = unfrozen_fraction[0][c];
@@ -368,9 +370,9 @@ SubgridEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
       mass_source[0][c] += area_fracs[1][c] * flux.M_surf;
       energy_source[0][c] += area_fracs[1][c] * flux.E_surf * 1.e-6;
 
-      double area_to_volume = mesh.cell_volume(c) / mesh_ss.cell_volume(cells[0]);
-      ss_mass_source[0][cells[0]] += area_fracs[1][c] * flux.M_subsurf * area_to_volume * params.density_water / 0.0180153; // convert from m/m^2/s to mol/m^3/s
-      ss_energy_source[0][cells[0]] += area_fracs[1][c] * flux.E_subsurf * area_to_volume * 1.e-6; // convert from W/m^2 to MW/m^3
+      double area_to_volume = mesh.cell_volume(c) / mesh_ss.cell_volume(top_c);
+      ss_mass_source[0][top_c] += area_fracs[1][c] * flux.M_subsurf * area_to_volume * params.density_water / 0.0180153; // convert from m/m^2/s to mol/m^3/s
+      ss_energy_source[0][top_c] += area_fracs[1][c] * flux.E_subsurf * area_to_volume * 1.e-6; // convert from W/m^2 to MW/m^3
 
       snow_source[0][c] += area_fracs[1][c] * flux.M_snow;
       new_snow[0][c] += area_fracs[1][c] * met.Ps;
@@ -650,6 +652,15 @@ SubgridEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S)
     S->GetField(qE_cond_key_, qE_cond_key_)->set_initialized(true);
   }
   
+  // met data streamed from file
+  if (plist_.isSublist("meteorological data")) {
+    const Teuchos::ParameterList& met_list = plist_.sublist("meteorological data");
+    for (const auto& met_key : { met_sw_key_, met_lw_key_, met_air_temp_key_, met_rel_hum_key_,
+                                 met_wind_speed_key_, met_prain_key_, met_psnow_key_ }) {
+      Relations::TimeSeriesEvaluator::Configure(*S, met_key, met_list, Keys::getVarName(met_key));
+    }
+  }
+
   for (auto dep_key : dependencies_) {
     auto fac = S->RequireField(dep_key);
     if (Keys::getDomain(dep_key) == domain_ss_) {
@@ -22,7 +22,12 @@ to first cover water (likely ice), then cover land, as both water and snow
 prefer low-lying depressions due to gravity- and wind-driven redistributions,
 respectively.
 
-* 
+* `"meteorological data`" ``[list]`` **optional** If given, the incoming
+  radiation, air temperature, relative humidity, wind speed and
+  precipitation are read from this HDF5 time series file, each from the
+  dataset named by its variable, e.g. `"air_temperature`", unless its
+  evaluator is already listed.  Holds the parameters of a `"time series`"
+  evaluator other than `"value header`".
 
 */
 
@@ -0,0 +1,115 @@
+#include <cmath>
+#include "UnitTest++.h"
+
+#include "Epetra_MpiComm.h"
+#include "Teuchos_ParameterList.hpp"
+
+#include "MeshFactory.hh"
+#include "CompositeVector.hh"
+#include "TreeVector.hh"
+
+#include "timestep_controller_lte.hh"
+
+using namespace Amanzi;
+
+// A one cell solution vector.
+struct solution {
+  Epetra_MpiComm comm;
+  Teuchos::RCP<TreeVector> u;
+
+  solution() :
+      comm(MPI_COMM_SELF)
+  {
+    AmanziMesh::FrameworkPreference pref;
+    pref.clear();
+    pref.push_back(AmanziMesh::MSTK);
+
+    AmanziMesh::MeshFactory meshfactory(&comm);
+    meshfactory.preference(pref);
+    Teuchos::RCP<AmanziMesh::Mesh> mesh = meshfactory(0.,0.,0., 1.,1.,1., 1,1,1);
+
+    CompositeVectorSpace space;
+    space.SetMesh(mesh)->SetGhosted(false)->SetComponent("cell", AmanziMesh::CELL, 1);
+    u = Teuchos::rcp(new TreeVector());
+    u->SetData(Teuchos::rcp(new CompositeVector(space)));
+  }
+
+  double value() const { return (*u->Data()->ViewComponent("cell",false))[0][0]; }
+};
+
+
+// The error is the LTE of the primary variable itself, in units of the
+// tolerances, and is not scaled by the timestep.
+TEST_FIXTURE(solution, TimestepControllerLTEUnits) {
+  Teuchos::ParameterList plist;
+  plist.set("absolute error tolerance", 1.0);
+  plist.set("relative error tolerance", 0.);
+  TimestepControllerLTE lte(plist, *u);
+  bool reject;
+
+  // u = t^2 with unit steps: the extrapolation to t = 2 is 2, not 4, and the
+  // LTE is 1/2 of that difference.
+  u->PutScalar(0.);
+  lte.StartStep(*u);
+  u->PutScalar(1.);
+  CHECK(lte.EstimateTimestep(1., *u, reject) < 0.);  // no history yet
+  lte.CommitStep(1.);
+
+  lte.StartStep(*u);
+  u->PutScalar(4.);
+  double dt_next = lte.EstimateTimestep(1., *u, reject);
+  CHECK_CLOSE(1., lte.error(), 1.e-12);
+  CHECK_CLOSE(0.9, dt_next, 1.e-12);
+  CHECK(!reject);
+
+  // a much larger change is rejected, and the step cut
+  u->PutScalar(42.);
+  dt_next = lte.EstimateTimestep(1., *u, reject);
+  CHECK_CLOSE(20., lte.error(), 1.e-12);
+  CHECK(reject);
+  CHECK_CLOSE(0.9 / std::sqrt(20.), dt_next, 1.e-12);
+}
+
+
+// Backward Euler on du/dt = -u, from a small initial step.  The controller
+// grows the step as the solution smooths out, taking a small fraction of the
+// steps a fixed step would, without rejecting any.
+TEST_FIXTURE(solution, TimestepControllerLTESmoothDecay) {
+  Teuchos::ParameterList plist;
+  plist.set("absolute error tolerance", 1.e-6);
+  plist.set("relative error tolerance", 1.e-3);
+  TimestepControllerLTE lte(plist, *u);
+
+  double t = 0., t_final = 10.;
+  double dt = 1.e-3, dt_first = dt;
+  double dt_max = 0.;
+  int nsteps = 0, nrejected = 0;
+  u->PutScalar(1.);
+
+  while (t < t_final - 1.e-12) {
+    dt = std::min(dt, t_final - t);
+    double u_old = value();
+    lte.StartStep(*u);
+    u->PutScalar(u_old / (1. + dt));
+
+    bool reject = false;
+    double dt_next = lte.EstimateTimestep(dt, *u, reject);
+    if (reject) {
+      u->PutScalar(u_old);
+      dt = dt_next;
+      nrejected++;
+      continue;
+    }
+
+    lte.CommitStep(dt);
+    t += dt;
+    nsteps++;
+    dt_max = std::max(dt_max, dt);
+    if (dt_next > 0.) dt = dt_next;
+  }
+
+  CHECK_EQUAL(0, nrejected);
+  CHECK(nsteps < 500);
+  CHECK(dt_max > 50. * dt_first);
+  CHECK_CLOSE(std::exp(-t_final), value(), 0.5 * std::exp(-t_final));
+}
@@ -0,0 +1,109 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/* -------------------------------------------------------------------------
+ATS
+
+License: see $ATS_DIR/COPYRIGHT
+Author: Ethan Coon
+
+Timestep selection from an estimate of the local truncation error.
+------------------------------------------------------------------------- */
+
+#include <algorithm>
+#include <cmath>
+
+#include "timestep_controller_lte.hh"
+
+namespace Amanzi {
+
+TimestepControllerLTE::TimestepControllerLTE(Teuchos::ParameterList& plist,
+        const TreeVector& solution) :
+    dt_prev_(-1.),
+    error_(0.)
+{
+  atol_ = plist.get<double>("absolute error tolerance", 1.0);
+  rtol_ = plist.get<double>("relative error tolerance", 1.e-3);
+  safety_ = plist.get<double>("safety factor", 0.9);
+  max_increase_ = plist.get<double>("max increase factor", 5.0);
+  max_decrease_ = plist.get<double>("max decrease factor", 0.2);
+  reject_factor_ = plist.get<double>("rejection factor", 10.0);
+
+  // reductions use the communicator of the first leaf
+  const TreeVector* leaf = &solution;
+  while (leaf->Data() == Teuchos::null) leaf = leaf->SubVector(0).get();
+  const CompositeVector& leaf_cv = *leaf->Data();
+  comm_ = Teuchos::rcp(leaf_cv.ViewComponent(*leaf_cv.begin(), false)->Comm().Clone());
+
+  u_old_ = Teuchos::rcp(new TreeVector(solution));
+  u_prev_ = Teuchos::rcp(new TreeVector(solution));
+  lte_ = Teuchos::rcp(new TreeVector(solution));
+}
+
+
+void TimestepControllerLTE::StartStep(const TreeVector& u_old) {
+  *u_old_ = u_old;
+}
+
+
+double TimestepControllerLTE::EstimateTimestep(double dt, const TreeVector& u_new,
+        bool& reject) {
+  reject = false;
+  if (dt_prev_ <= 0.) return -1.;
+
+  // lte = dt/(dt + dt_prev) * (u_new - u_pred), where
+  // u_pred = (1 + r) u_old - r u_prev, r = dt/dt_prev
+  double r = dt / dt_prev_;
+  *lte_ = u_new;
+  lte_->Update(-(1. + r), *u_old_, 1.);
+  lte_->Update(r, *u_prev_, 1.);
+  lte_->Scale(dt / (dt + dt_prev_));
+
+  double l_norm[2] = { 0., 0. };
+  Norm_(*lte_, u_new, l_norm[0], l_norm[1]);
+  double norm[2] = { 0., 0. };
+  comm_->SumAll(l_norm, norm, 2);
+  error_ = norm[1] > 0. ? std::sqrt(norm[0] / norm[1]) : 0.;
+
+  if (std::isnan(error_)) {
+    reject = true;
+    return dt * max_decrease_;
+  }
+  reject = error_ > reject_factor_;
+
+  // backward Euler's LTE is O(dt^2)
+  double factor = error_ > 0. ? safety_ / std::sqrt(error_) : max_increase_;
+  factor = std::min(std::max(factor, max_decrease_), max_increase_);
+  return dt * factor;
+}
+
+
+void TimestepControllerLTE::CommitStep(double dt) {
+  *u_prev_ = *u_old_;
+  dt_prev_ = dt;
+}
+
+
+void TimestepControllerLTE::Norm_(const TreeVector& lte, const TreeVector& u,
+        double& sum, double& count) const {
+  if (lte.Data() != Teuchos::null) {
+    const CompositeVector& lte_cv = *lte.Data();
+    const CompositeVector& u_cv = *u.Data();
+    for (CompositeVector::name_iterator comp=lte_cv.begin(); comp!=lte_cv.end(); ++comp) {
+      const Epetra_MultiVector& lte_v = *lte_cv.ViewComponent(*comp, false);
+      const Epetra_MultiVector& u_v = *u_cv.ViewComponent(*comp, false);
+      for (int k=0; k!=lte_v.NumVectors(); ++k) {
+        for (int i=0; i!=lte_v.MyLength(); ++i) {
+          double err = lte_v[k][i] / (atol_ + rtol_ * std::abs(u_v[k][i]));
+          sum += err * err;
+        }
+      }
+      count += lte_v.MyLength() * lte_v.NumVectors();
+    }
+  }
+
+  for (int i=0; i!=lte.SubVectors().size(); ++i) {
+    Norm_(*lte.SubVector(i), *u.SubVector(i), sum, count);
+  }
+}
+
+} // namespace
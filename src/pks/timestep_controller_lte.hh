@@ -0,0 +1,109 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! Timestep selection from an estimate of the local truncation error.
+
+/*
+  ATS is released under the three-clause BSD License. 
+  The terms of use and "as is" disclaimer for this license are 
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+
+/*!
+
+``TimestepControllerLTE`` chooses the next timestep of a backward Euler
+integrator from an embedded estimate of its local truncation error, rather
+than from the nonlinear iteration count alone.  The estimate compares the
+converged solution with a linear extrapolation from the previous two steps:
+
+:math:`LTE \approx \frac{h_n}{h_n + h_{n-1}} (u_n - u_n^{pred})`
+
+and is measured directly on the primary variables, in the weighted root mean
+square norm:
+
+:math:`\| LTE \| = \left( \frac{1}{N} \sum_i \left( \frac{LTE_i}{a + r |u_i|} \right)^2 \right)^{1/2}`
+
+where :math:`a` and :math:`r` are absolute and relative tolerances in the
+units of the primary variable.  The LTE of backward Euler is second order in
+the timestep, so the next step is:
+
+:math:`h_{n+1} = s h_n \| LTE \|^{-1/2}`
+
+bounded by the increase and decrease factors below.  This allows steps to grow
+quickly through smooth periods while remaining limited by the nonlinear
+solver when it struggles.
+
+This is enabled by setting `"truncation error control`" to true in the
+`"time integrator`" sublist, with parameters from the `"truncation error
+control parameters`" sublist:
+
+* `"absolute error tolerance`" ``[double]`` **1.0** :math:`a` above, in the
+  units of the primary variable, e.g. [Pa] or [K].
+
+* `"relative error tolerance`" ``[double]`` **1.e-3** :math:`r` above.
+
+* `"safety factor`" ``[double]`` **0.9** :math:`s` above.
+
+* `"max increase factor`" ``[double]`` **5.0**
+
+* `"max decrease factor`" ``[double]`` **0.2**
+
+* `"rejection factor`" ``[double]`` **10.0** Reject the step if the error
+  estimate exceeds this multiple of the tolerance.
+
+*/
+
+#ifndef ATS_TIMESTEP_CONTROLLER_LTE_HH_
+#define ATS_TIMESTEP_CONTROLLER_LTE_HH_
+
+#include "Epetra_Comm.h"
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+
+#include "TreeVector.hh"
+
+namespace Amanzi {
+
+class TimestepControllerLTE {
+
+ public:
+  TimestepControllerLTE(Teuchos::ParameterList& plist,
+                        const TreeVector& solution);
+
+  // Save the solution at the start of a step.
+  void StartStep(const TreeVector& u_old);
+
+  // Estimate the error of the converged solution u_new of a step of size dt,
+  // returning the recommended next timestep.  If no history is available,
+  // returns a negative value.  reject is set if the step should be retaken.
+  double EstimateTimestep(double dt, const TreeVector& u_new, bool& reject);
+
+  // Accept the step, keeping its starting solution as history.
+  void CommitStep(double dt);
+
+  double error() const { return error_; }
+
+ protected:
+  // Add the squared, weighted owned entries of lte, relative to u, to sum,
+  // and their number to count.
+  void Norm_(const TreeVector& lte, const TreeVector& u,
+             double& sum, double& count) const;
+
+ protected:
+  double atol_, rtol_;
+  double safety_;
+  double max_increase_, max_decrease_;
+  double reject_factor_;
+
+  Teuchos::RCP<Epetra_Comm> comm_;
+  Teuchos::RCP<TreeVector> u_old_;
+  Teuchos::RCP<TreeVector> u_prev_;
+  Teuchos::RCP<TreeVector> lte_;
+  double dt_prev_;
+  double error_;
+};
+
+} // namespace
+
+#endif
@@ -9,6 +9,7 @@
   Author: Jeffrey Johnson (jnjohnson@lbl.gov)
 */
 
+#include "region_entity_cache.hh"
 #include "TransportBoundaryFunction_Alquimia.hh"
 
 #ifdef ALQUIMIA_ENABLED
@@ -70,8 +71,8 @@ void TransportBoundaryFunction_Alquimia::Init_(const std::vector<std::string>& r
     // are applied on faces).
     assert(mesh_->valid_set_name(regions[i], AmanziMesh::FACE));
 
-    AmanziMesh::Entity_ID_List block;
-    mesh_->get_set_entities(regions[i], AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED, &block);
+    const AmanziMesh::Entity_ID_List& block =
+        RegionEntityCache::Get(mesh_, regions[i], AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
     int nblock = block.size();
 
     // Now get the cells that are attached to these faces.
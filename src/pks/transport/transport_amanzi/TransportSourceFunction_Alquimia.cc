@@ -9,6 +9,7 @@
   Author: Konstantin Lipnikov (lipnikov@lanl.gov)
 */
 
+#include "region_entity_cache.hh"
 #include "TransportSourceFunction_Alquimia.hh"
 
 #ifdef ALQUIMIA_ENABLED
@@ -66,8 +67,8 @@ TransportSourceFunction_Alquimia::~TransportSourceFunction_Alquimia()
 void TransportSourceFunction_Alquimia::Init_(const std::vector<std::string>& regions)
 {
   for (int i = 0; i < regions.size(); ++i) {
-    AmanziMesh::Entity_ID_List block;
-    mesh_->get_set_entities(regions[i], AmanziMesh::CELL, AmanziMesh::Parallel_type::ALL, &block);
+    const AmanziMesh::Entity_ID_List& block =
+        RegionEntityCache::Get(mesh_, regions[i], AmanziMesh::CELL, AmanziMesh::Parallel_type::ALL);
     int nblock = block.size();
 
     // Now get the cells that are attached to these faces.
@@ -19,6 +19,7 @@
 #include "nlfv.hh"
 #include "Tensor.hh"
 #include "PreconditionerFactory.hh"
+#include "region_entity_cache.hh"
 
 #include "TransportDefs.hh"
 #include "Transport_PK_ATS.hh"
@@ -79,12 +80,12 @@ void Transport_PK_ATS::CalculateDiffusionTensor_(
   for (int mb = 0; mb < mat_properties_.size(); mb++) {
     Teuchos::RCP<MaterialProperties> spec = mat_properties_[mb]; 
 
-    std::vector<AmanziMesh::Entity_ID> block;
     for (int r = 0; r < (spec->regions).size(); r++) {
       std::string region = (spec->regions)[r];
-      mesh_->get_set_entities(region, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &block);
+      const AmanziMesh::Entity_ID_List& block =
+          RegionEntityCache::Get(mesh_, region, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
 
-      AmanziMesh::Entity_ID_List::iterator c;
+      AmanziMesh::Entity_ID_List::const_iterator c;
       if (phase == TRANSPORT_PHASE_LIQUID) {
         for (c = block.begin(); c != block.end(); c++) {
           D_[*c] += md * spec->tau[phase] * porosity[0][*c] * saturation[0][*c];
@@ -1299,10 +1299,15 @@ void Transport_PK_ATS::AdvanceDonorUpwind(double dt_cycle)
   mass_solutes_source_.assign(num_aqueous + num_gaseous, 0.0);
   mass_solutes_bc_.assign(num_aqueous + num_gaseous, 0.0);
 
-  // populating next state of concentrations
-  tcc->ScatterMasterToGhosted("cell");
+  // populating next state of concentrations; the ghost exchange is overlapped
+  // with forming the conservative state in owned cells
   Epetra_MultiVector& tcc_prev = *tcc->ViewComponent("cell", true);
   Epetra_MultiVector& tcc_next = *tcc_tmp->ViewComponent("cell", true);
+  if (tcc_scatter_ == Teuchos::null) {
+    tcc_scatter_ = Teuchos::rcp(new Operators::SplitPhaseScatter(mesh_->cell_map(false),
+            mesh_->cell_map(true)));
+  }
+  tcc_scatter_->Begin(tcc_prev);
 
   // prepare conservative state in master and slave cells
   double vol_phi_ws_den, tcc_flux;
@@ -1332,6 +1337,7 @@ void Transport_PK_ATS::AdvanceDonorUpwind(double dt_cycle)
     else  *vo_->os()<<std::setprecision(10)<<"Subsurface mass start "<<mass_start<<"\n";
   }
 
+  tcc_scatter_->End(Teuchos::ptr(&tcc_prev));
   
   // advance all components at once
   for (int f = 0; f < nfaces_wghost; f++) {  // loop over master and slave faces
@@ -44,6 +44,7 @@
 #include "LimiterCell.hh"
 #include "MDMPartition.hh"
 #include "MultiscaleTransportPorosityPartition.hh"
+#include "SplitPhaseScatter.hh"
 #include "TransportDomainFunction.hh"
 #include "TransportDefs.hh"
 
@@ -287,6 +288,7 @@ typedef double AnalyticFunction(const AmanziGeometry::Point&, const double);
 
   Teuchos::RCP<Epetra_Import> cell_importer;  // parallel communicators
   Teuchos::RCP<Epetra_Import> face_importer;
+  Teuchos::RCP<Operators::SplitPhaseScatter> tcc_scatter_;
 
   // mechanical dispersion and molecual diffusion
   Teuchos::RCP<MDMPartition> mdm_;